@@ -0,0 +1,249 @@
+// Copyright 2021 Mickael Daniel. All Rights Reserved.
+
+#include "Abilities/Attributes/GSCAttributeInitializationCache.h"
+
+#include "AttributeSet.h"
+#include "Engine/DataTable.h"
+#include "UObject/UObjectGlobals.h"
+
+void FGSCAttributeInitializationTable::Apply(UAttributeSet* InAttributeSet) const
+{
+	check(InAttributeSet);
+
+	for (const FEntry& Entry : Entries)
+	{
+		if (Entry.AttributeDataProperty)
+		{
+			FGameplayAttributeData* DataPtr = Entry.AttributeDataProperty->ContainerPtrToValuePtr<FGameplayAttributeData>(InAttributeSet);
+			DataPtr->SetBaseValue(Entry.Value);
+			DataPtr->SetCurrentValue(Entry.Value);
+		}
+		else
+		{
+			Entry.NumericProperty->SetFloatingPointPropertyValue(Entry.NumericProperty->ContainerPtrToValuePtr<void>(InAttributeSet), Entry.Value);
+		}
+	}
+
+	InAttributeSet->PrintDebug();
+}
+
+FGSCAttributeInitializationCache::FGSCAttributeInitializationCache()
+{
+#if WITH_EDITOR
+	// Compiled tables hold on to properties, which are gone once a class is recompiled
+	ObjectsReplacedHandle = FCoreUObjectDelegates::OnObjectsReplaced.AddRaw(this, &FGSCAttributeInitializationCache::HandleObjectsReplaced);
+	ReloadCompleteHandle = FCoreUObjectDelegates::ReloadCompleteDelegate.AddRaw(this, &FGSCAttributeInitializationCache::HandleReloadComplete);
+#endif
+}
+
+FGSCAttributeInitializationCache::~FGSCAttributeInitializationCache()
+{
+#if WITH_EDITOR
+	FCoreUObjectDelegates::OnObjectsReplaced.Remove(ObjectsReplacedHandle);
+	FCoreUObjectDelegates::ReloadCompleteDelegate.Remove(ReloadCompleteHandle);
+#endif
+}
+
+FGSCAttributeInitializationCache& FGSCAttributeInitializationCache::Get()
+{
+	static FGSCAttributeInitializationCache Instance;
+	return Instance;
+}
+
+void FGSCAttributeInitializationCache::InitAttributeSet(UAttributeSet* InAttributeSet, const UDataTable* InDataTable)
+{
+	if (!InAttributeSet || !InDataTable)
+	{
+		return;
+	}
+
+	// Sets may override it, UGSCAttributeSetBase goes through ApplyCompiledTable()
+	InAttributeSet->InitFromMetaDataTable(InDataTable);
+}
+
+void FGSCAttributeInitializationCache::ApplyCompiledTable(UAttributeSet* InAttributeSet, const UDataTable* InDataTable)
+{
+	if (!InAttributeSet || !InDataTable)
+	{
+		return;
+	}
+
+	FindOrCompile(InAttributeSet->GetClass(), InDataTable)->Apply(InAttributeSet);
+}
+
+void FGSCAttributeInitializationCache::ResetAttributeSet(UAttributeSet* InAttributeSet, const UDataTable* InDataTable)
+{
+	if (!InAttributeSet)
+	{
+		return;
+	}
+
+	const UClass* AttributeSetClass = InAttributeSet->GetClass();
+	TArray<const FProperty*>* Properties = AttributeProperties.Find(AttributeSetClass);
+	if (!Properties)
+	{
+		Properties = &AttributeProperties.Add(AttributeSetClass);
+		for (TFieldIterator<FProperty> It(AttributeSetClass, EFieldIteratorFlags::IncludeSuper); It; ++It)
+		{
+			if (CastField<FNumericProperty>(*It) || FGameplayAttribute::IsGameplayAttributeDataProperty(*It))
+			{
+				Properties->Add(*It);
+			}
+		}
+	}
+
+	const UAttributeSet* DefaultObject = AttributeSetClass->GetDefaultObject<UAttributeSet>();
+	for (const FProperty* Property : *Properties)
+	{
+		Property->CopyCompleteValue_InContainer(InAttributeSet, DefaultObject);
+	}
+
+	InitAttributeSet(InAttributeSet, InDataTable);
+}
+
+TSharedRef<const FGSCAttributeInitializationTable> FGSCAttributeInitializationCache::FindOrCompile(const UClass* InAttributeSetClass, const UDataTable* InDataTable)
+{
+	check(InAttributeSetClass);
+	check(InDataTable);
+
+	const FTableKey Key(TObjectKey<UClass>(InAttributeSetClass), TObjectKey<UDataTable>(InDataTable));
+	if (const TSharedRef<const FGSCAttributeInitializationTable>* ExistingTable = Tables.Find(Key))
+	{
+		return *ExistingTable;
+	}
+
+	// Cache miss, good time to get rid of entries for classes and tables no longer around
+	PruneStaleEntries();
+
+	const TObjectKey<UDataTable> DataTableKey(InDataTable);
+	if (!ObservedDataTables.Contains(DataTableKey))
+	{
+		// Reimport and edits of the data table go through OnDataTableChanged
+		const FDelegateHandle Handle = const_cast<UDataTable*>(InDataTable)->OnDataTableChanged().AddStatic(&FGSCAttributeInitializationCache::HandleDataTableChanged, MakeWeakObjectPtr(InDataTable));
+		ObservedDataTables.Add(DataTableKey, Handle);
+	}
+
+	TSharedRef<const FGSCAttributeInitializationTable> Table = Compile(InAttributeSetClass, InDataTable);
+	Tables.Add(Key, Table);
+	return Table;
+}
+
+void FGSCAttributeInitializationCache::Invalidate(const UDataTable* InDataTable)
+{
+	const TObjectKey<UDataTable> DataTableKey(InDataTable);
+	for (auto It = Tables.CreateIterator(); It; ++It)
+	{
+		if (It.Key().Value == DataTableKey)
+		{
+			It.RemoveCurrent();
+		}
+	}
+
+	// Listening again once a table is compiled for it
+	FDelegateHandle Handle;
+	if (ObservedDataTables.RemoveAndCopyValue(DataTableKey, Handle))
+	{
+		StopObserving(DataTableKey, Handle);
+	}
+}
+
+void FGSCAttributeInitializationCache::Reset()
+{
+	for (const TPair<TObjectKey<UDataTable>, FDelegateHandle>& Pair : ObservedDataTables)
+	{
+		StopObserving(Pair.Key, Pair.Value);
+	}
+
+	Tables.Reset();
+	AttributeProperties.Reset();
+	ObservedDataTables.Reset();
+}
+
+void FGSCAttributeInitializationCache::PruneStaleEntries()
+{
+	for (auto It = Tables.CreateIterator(); It; ++It)
+	{
+		if (!It.Key().Key.ResolveObjectPtr() || !It.Key().Value.ResolveObjectPtr())
+		{
+			It.RemoveCurrent();
+		}
+	}
+
+	for (auto It = AttributeProperties.CreateIterator(); It; ++It)
+	{
+		if (!It.Key().ResolveObjectPtr())
+		{
+			It.RemoveCurrent();
+		}
+	}
+
+	// Delegates of collected tables went away with them
+	for (auto It = ObservedDataTables.CreateIterator(); It; ++It)
+	{
+		if (!It.Key().ResolveObjectPtr())
+		{
+			It.RemoveCurrent();
+		}
+	}
+}
+
+void FGSCAttributeInitializationCache::StopObserving(const TObjectKey<UDataTable>& InDataTableKey, const FDelegateHandle& InHandle)
+{
+	if (UDataTable* DataTable = InDataTableKey.ResolveObjectPtr())
+	{
+		DataTable->OnDataTableChanged().Remove(InHandle);
+	}
+}
+
+TSharedRef<const FGSCAttributeInitializationTable> FGSCAttributeInitializationCache::Compile(const UClass* InAttributeSetClass, const UDataTable* InDataTable)
+{
+	static const FString Context = FString(TEXT("FGSCAttributeInitializationCache::Compile"));
+
+	TSharedRef<FGSCAttributeInitializationTable> Table = MakeShared<FGSCAttributeInitializationTable>();
+
+	// Mirrors UAttributeSet::InitFromMetaDataTable()
+	for (TFieldIterator<FProperty> It(InAttributeSetClass, EFieldIteratorFlags::IncludeSuper); It; ++It)
+	{
+		FProperty* Property = *It;
+		FNumericProperty* NumericProperty = CastField<FNumericProperty>(Property);
+		const bool bIsAttributeData = !NumericProperty && FGameplayAttribute::IsGameplayAttributeDataProperty(Property);
+		if (!NumericProperty && !bIsAttributeData)
+		{
+			continue;
+		}
+
+		const FString RowNameStr = FString::Printf(TEXT("%s.%s"), *Property->GetOwnerVariant().GetName(), *Property->GetName());
+		const FAttributeMetaData* MetaData = InDataTable->FindRow<FAttributeMetaData>(FName(*RowNameStr), Context, false);
+		if (!MetaData)
+		{
+			continue;
+		}
+
+		FGSCAttributeInitializationTable::FEntry& Entry = Table->Entries.AddDefaulted_GetRef();
+		Entry.AttributeDataProperty = bIsAttributeData ? CastFieldChecked<FStructProperty>(Property) : nullptr;
+		Entry.NumericProperty = NumericProperty;
+		Entry.Value = MetaData->BaseValue;
+	}
+
+	return Table;
+}
+
+void FGSCAttributeInitializationCache::HandleDataTableChanged(const TWeakObjectPtr<const UDataTable> InDataTable)
+{
+	if (const UDataTable* DataTable = InDataTable.Get())
+	{
+		Get().Invalidate(DataTable);
+	}
+}
+
+#if WITH_EDITOR
+void FGSCAttributeInitializationCache::HandleObjectsReplaced(const TMap<UObject*, UObject*>& InReplacementMap)
+{
+	Reset();
+}
+
+void FGSCAttributeInitializationCache::HandleReloadComplete(EReloadCompleteReason InReason)
+{
+	Reset();
+}
+#endif
@@ -7,6 +7,17 @@
 #include "Net/UnrealNetwork.h"
 #include "GSCLog.h"
 
+UGSCAttributeSet::UGSCAttributeSet()
+{
+	const UClass* NativeClass = GetClass();
+	while (NativeClass && !NativeClass->HasAnyClassFlags(CLASS_Native))
+	{
+		NativeClass = NativeClass->GetSuperClass();
+	}
+
+	bDispatchExecutionDataHandlers = NativeClass != UGSCAttributeSet::StaticClass();
+}
+
 void UGSCAttributeSet::PreAttributeChange(const FGameplayAttribute& Attribute, float& NewValue)
 {
     // This is called whenever attributes change, so for max health/mana we want to scale the current totals to match
@@ -32,37 +43,81 @@ void UGSCAttributeSet::PreAttributeChange(const FGameplayAttribute& Attribute, f
 	}
 }
 
-void UGSCAttributeSet::PostGameplayEffectExecute(const FGameplayEffectModCallbackData& Data)
+void UGSCAttributeSet::HandlePostGameplayEffectExecute(const FGSCAttributeSetExecutionContext& ExecutionContext)
 {
-    Super::PostGameplayEffectExecute(Data);
+    Super::HandlePostGameplayEffectExecute(ExecutionContext);
 
-	GSC_WLOG(VeryVerbose, TEXT("PostGameplayEffectExecute called for %s.%s"), *GetName(), *Data.EvaluatedData.Attribute.AttributeName)
+	const FGameplayAttribute& Attribute = ExecutionContext.GetModCallbackData().EvaluatedData.Attribute;
+	GSC_WLOG(VeryVerbose, TEXT("PostGameplayEffectExecute called for %s.%s"), *GetName(), *Attribute.AttributeName)
 
-	FGSCAttributeSetExecutionData ExecutionData;
-	GetExecutionDataFromMod(Data, ExecutionData);
+	// Compatibility path for native subclasses overriding the execution data handlers
+	if (bDispatchExecutionDataHandlers)
+	{
+		DispatchExecutionDataHandlers(ExecutionContext);
+		return;
+	}
 
-    if (Data.EvaluatedData.Attribute == GetDamageAttribute())
+    if (Attribute == GetDamageAttribute())
     {
-    	HandleDamageAttribute(ExecutionData);
+    	HandleDamageAttributeWithContext(ExecutionContext);
     }
-	else if (Data.EvaluatedData.Attribute == GetStaminaDamageAttribute())
+	else if (Attribute == GetStaminaDamageAttribute())
 	{
-		HandleStaminaDamageAttribute(ExecutionData);
+		HandleStaminaDamageAttributeWithContext(ExecutionContext);
 	}
-    else if (Data.EvaluatedData.Attribute == GetHealthAttribute())
+    else if (Attribute == GetHealthAttribute())
     {
-    	HandleHealthAttribute(ExecutionData);
+    	HandleHealthAttributeWithContext(ExecutionContext);
     }
-    else if (Data.EvaluatedData.Attribute == GetStaminaAttribute())
+    else if (Attribute == GetStaminaAttribute())
     {
-    	HandleStaminaAttribute(ExecutionData);
+    	HandleStaminaAttributeWithContext(ExecutionContext);
     }
-    else if (Data.EvaluatedData.Attribute == GetManaAttribute())
+    else if (Attribute == GetManaAttribute())
     {
-    	HandleManaAttribute(ExecutionData);
+    	HandleManaAttributeWithContext(ExecutionContext);
     }
 }
 
+void UGSCAttributeSet::DispatchExecutionDataHandlers(const FGSCAttributeSetExecutionContext& ExecutionContext)
+{
+	const FGameplayAttribute& Attribute = ExecutionContext.GetModCallbackData().EvaluatedData.Attribute;
+	const bool bHandledAttribute = Attribute == GetDamageAttribute()
+		|| Attribute == GetStaminaDamageAttribute()
+		|| Attribute == GetHealthAttribute()
+		|| Attribute == GetStaminaAttribute()
+		|| Attribute == GetManaAttribute();
+
+	if (!bHandledAttribute)
+	{
+		return;
+	}
+
+	FGSCAttributeSetExecutionData ExecutionData;
+	ExecutionContext.ToExecutionData(ExecutionData);
+
+	if (Attribute == GetDamageAttribute())
+	{
+		HandleDamageAttribute(ExecutionData);
+	}
+	else if (Attribute == GetStaminaDamageAttribute())
+	{
+		HandleStaminaDamageAttribute(ExecutionData);
+	}
+	else if (Attribute == GetHealthAttribute())
+	{
+		HandleHealthAttribute(ExecutionData);
+	}
+	else if (Attribute == GetStaminaAttribute())
+	{
+		HandleStaminaAttribute(ExecutionData);
+	}
+	else if (Attribute == GetManaAttribute())
+	{
+		HandleManaAttribute(ExecutionData);
+	}
+}
+
 void UGSCAttributeSet::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
 {
     Super::GetLifetimeReplicatedProps(OutLifetimeProps);
@@ -139,12 +194,95 @@ void UGSCAttributeSet::SetAttributeClamped(const FGameplayAttribute& Attribute,
 	ASC->SetNumericAttributeBase(Attribute, NewValue);
 }
 
+void UGSCAttributeSet::HandleDamageAttributeWithContext(const FGSCAttributeSetExecutionContext& ExecutionContext)
+{
+	// Store a local copy of the amount of Damage done and clear the Damage attribute.
+	const float LocalDamageDone = GetDamage();
+	SetDamage(0.f);
+
+	if (LocalDamageDone <= 0.f)
+	{
+		return;
+	}
+
+	UGSCCoreComponent* TargetCoreComponent = ExecutionContext.GetTargetCoreComponent();
+
+	// If actor was alive before damage is added, handle damage
+	// This prevents damage being added to dead things and replaying death animations
+	if (TargetCoreComponent && !TargetCoreComponent->IsAlive())
+	{
+		GSC_LOG(Warning, TEXT("UGSCAttributeSet::PostGameplayEffectExecute() %s character or pawn is NOT alive when receiving damage"), *GetNameSafe(ExecutionContext.GetTargetActor()));
+		return;
+	}
+
+	// Apply the Health change and then clamp it.
+	const float NewHealth = GetHealth() - LocalDamageDone;
+	const float ClampMinimumValue = GetClampMinimumValueFor(GetHealthAttribute());
+	SetHealth(FMath::Clamp(NewHealth, ClampMinimumValue, GetMaxHealth()));
+
+	if (TargetCoreComponent)
+	{
+		const FGameplayTagContainer& SourceTags = ExecutionContext.GetSourceTags();
+		TargetCoreComponent->HandleDamage(LocalDamageDone, SourceTags, ExecutionContext.GetSourceActor());
+		TargetCoreComponent->HandleHealthChange(-LocalDamageDone, SourceTags);
+	}
+}
+
+void UGSCAttributeSet::HandleStaminaDamageAttributeWithContext(const FGSCAttributeSetExecutionContext& ExecutionContext)
+{
+	// Store a local copy of the amount of damage done and clear the damage attribute
+	const float LocalStaminaDamageDone = GetStaminaDamage();
+	SetStaminaDamage(0.f);
+
+	if (LocalStaminaDamageDone > 0.0f)
+	{
+		// Apply the stamina change and then clamp it
+		const float NewStamina = GetStamina() - LocalStaminaDamageDone;
+		SetStamina(FMath::Clamp(NewStamina, 0.0f, GetMaxStamina()));
+
+		if (UGSCCoreComponent* TargetCoreComponent = ExecutionContext.GetTargetCoreComponent())
+		{
+			TargetCoreComponent->HandleStaminaChange(-LocalStaminaDamageDone, ExecutionContext.GetSourceTags());
+		}
+	}
+}
+
+void UGSCAttributeSet::HandleHealthAttributeWithContext(const FGSCAttributeSetExecutionContext& ExecutionContext)
+{
+	const float ClampMinimumValue = GetClampMinimumValueFor(GetHealthAttribute());
+	SetHealth(FMath::Clamp(GetHealth(), ClampMinimumValue, GetMaxHealth()));
+
+	if (UGSCCoreComponent* TargetCoreComponent = ExecutionContext.GetTargetCoreComponent())
+	{
+		TargetCoreComponent->HandleHealthChange(ExecutionContext.GetDeltaValue(), ExecutionContext.GetSourceTags());
+	}
+}
+
+void UGSCAttributeSet::HandleStaminaAttributeWithContext(const FGSCAttributeSetExecutionContext& ExecutionContext)
+{
+	const float ClampMinimumValue = GetClampMinimumValueFor(GetStaminaAttribute());
+	SetStamina(FMath::Clamp(GetStamina(), ClampMinimumValue, GetMaxStamina()));
+
+	if (UGSCCoreComponent* TargetCoreComponent = ExecutionContext.GetTargetCoreComponent())
+	{
+		TargetCoreComponent->HandleStaminaChange(ExecutionContext.GetDeltaValue(), ExecutionContext.GetSourceTags());
+	}
+}
+
+void UGSCAttributeSet::HandleManaAttributeWithContext(const FGSCAttributeSetExecutionContext& ExecutionContext)
+{
+	const float ClampMinimumValue = GetClampMinimumValueFor(GetManaAttribute());
+	SetMana(FMath::Clamp(GetMana(), ClampMinimumValue, GetMaxMana()));
+
+	if (UGSCCoreComponent* TargetCoreComponent = ExecutionContext.GetTargetCoreComponent())
+	{
+		TargetCoreComponent->HandleManaChange(ExecutionContext.GetDeltaValue(), ExecutionContext.GetSourceTags());
+	}
+}
+
 void UGSCAttributeSet::HandleDamageAttribute(const FGSCAttributeSetExecutionData& ExecutionData)
 {
-	AActor* SourceActor = ExecutionData.SourceActor;
-	AActor* TargetActor = ExecutionData.TargetActor;
 	UGSCCoreComponent* TargetCoreComponent = ExecutionData.TargetCoreComponent;
-	const FGameplayTagContainer SourceTags = ExecutionData.SourceTags;
 
 	// Store a local copy of the amount of Damage done and clear the Damage attribute.
 	const float LocalDamageDone = GetDamage();
@@ -161,7 +299,7 @@ void UGSCAttributeSet::HandleDamageAttribute(const FGSCAttributeSetExecutionData
 			bAlive = TargetCoreComponent->IsAlive();
 			if (!bAlive)
 			{
-				GSC_LOG(Warning, TEXT("UGSCAttributeSet::PostGameplayEffectExecute() %s character or pawn is NOT alive when receiving damage"), *TargetActor->GetName());
+				GSC_LOG(Warning, TEXT("UGSCAttributeSet::PostGameplayEffectExecute() %s character or pawn is NOT alive when receiving damage"), *GetNameSafe(ExecutionData.TargetActor));
 			}
 		}
 
@@ -174,7 +312,8 @@ void UGSCAttributeSet::HandleDamageAttribute(const FGSCAttributeSetExecutionData
 
 			if (TargetCoreComponent)
 			{
-				TargetCoreComponent->HandleDamage(LocalDamageDone, SourceTags, SourceActor);
+				const FGameplayTagContainer& SourceTags = ExecutionData.SourceTags;
+				TargetCoreComponent->HandleDamage(LocalDamageDone, SourceTags, ExecutionData.SourceActor);
 				TargetCoreComponent->HandleHealthChange(-LocalDamageDone, SourceTags);
 			}
 		}
@@ -184,7 +323,6 @@ void UGSCAttributeSet::HandleDamageAttribute(const FGSCAttributeSetExecutionData
 void UGSCAttributeSet::HandleStaminaDamageAttribute(const FGSCAttributeSetExecutionData& ExecutionData)
 {
 	UGSCCoreComponent* TargetCoreComponent = ExecutionData.TargetCoreComponent;
-	const FGameplayTagContainer SourceTags = ExecutionData.SourceTags;
 
 	// Store a local copy of the amount of damage done and clear the damage attribute
 	const float LocalStaminaDamageDone = GetStaminaDamage();
@@ -198,7 +336,7 @@ void UGSCAttributeSet::HandleStaminaDamageAttribute(const FGSCAttributeSetExecut
 
 		if (TargetCoreComponent)
 		{
-			TargetCoreComponent->HandleStaminaChange(-LocalStaminaDamageDone, SourceTags);
+			TargetCoreComponent->HandleStaminaChange(-LocalStaminaDamageDone, ExecutionData.SourceTags);
 		}
 	}
 }
@@ -212,9 +350,7 @@ void UGSCAttributeSet::HandleHealthAttribute(const FGSCAttributeSetExecutionData
 
 	if (TargetCoreComponent)
 	{
-		const float DeltaValue = ExecutionData.DeltaValue;
-		const FGameplayTagContainer SourceTags = ExecutionData.SourceTags;
-		TargetCoreComponent->HandleHealthChange(DeltaValue, SourceTags);
+		TargetCoreComponent->HandleHealthChange(ExecutionData.DeltaValue, ExecutionData.SourceTags);
 	}
 }
 
@@ -227,9 +363,7 @@ void UGSCAttributeSet::HandleStaminaAttribute(const FGSCAttributeSetExecutionDat
 
 	if (TargetCoreComponent)
 	{
-		const float DeltaValue = ExecutionData.DeltaValue;
-		const FGameplayTagContainer SourceTags = ExecutionData.SourceTags;
-		TargetCoreComponent->HandleStaminaChange(DeltaValue, SourceTags);
+		TargetCoreComponent->HandleStaminaChange(ExecutionData.DeltaValue, ExecutionData.SourceTags);
 	}
 }
 
@@ -242,8 +376,6 @@ void UGSCAttributeSet::HandleManaAttribute(const FGSCAttributeSetExecutionData&
 
 	if (TargetCoreComponent)
 	{
-		const float DeltaValue = ExecutionData.DeltaValue;
-		const FGameplayTagContainer SourceTags = ExecutionData.SourceTags;
-		TargetCoreComponent->HandleManaChange(DeltaValue, SourceTags);
+		TargetCoreComponent->HandleManaChange(ExecutionData.DeltaValue, ExecutionData.SourceTags);
 	}
 }
@@ -5,6 +5,7 @@
 #include "GSCLog.h"
 #include "GameplayEffectExtension.h"
 #include "Abilities/GSCBlueprintFunctionLibrary.h"
+#include "Abilities/Attributes/GSCAttributeInitializationCache.h"
 #include "Components/GSCCoreComponent.h"
 #include "GameFramework/Pawn.h"
 
@@ -39,18 +40,134 @@ void UGSCAttributeSetBase::PreAttributeChange(const FGameplayAttribute& Attribut
     }
 }
 
+const FGameplayTagContainer& FGSCAttributeSetExecutionContext::GetSpecAssetTags() const
+{
+	if (!bSpecAssetTagsResolved)
+	{
+		Data.EffectSpec.GetAllAssetTags(SpecAssetTags);
+		bSpecAssetTagsResolved = true;
+	}
+
+	return SpecAssetTags;
+}
+
+UAbilitySystemComponent* FGSCAttributeSetExecutionContext::GetSourceASC() const
+{
+	return GetContext().GetOriginalInstigatorAbilitySystemComponent();
+}
+
+AActor* FGSCAttributeSetExecutionContext::GetSourceActor() const
+{
+	if (!bSourceActorResolved)
+	{
+		const UAbilitySystemComponent* SourceASC = GetSourceASC();
+
+		// Get the Source actor, which should be the damage causer (instigator)
+		if (SourceASC && SourceASC->AbilityActorInfo.IsValid() && SourceASC->AbilityActorInfo->AvatarActor.IsValid())
+		{
+			// Set the source actor based on context if it's set
+			AActor* EffectCauser = GetContext().GetEffectCauser();
+			SourceActor = EffectCauser ? EffectCauser : SourceASC->AbilityActorInfo->AvatarActor.Get();
+		}
+
+		bSourceActorResolved = true;
+	}
+
+	return SourceActor;
+}
+
+AActor* FGSCAttributeSetExecutionContext::GetTargetActor() const
+{
+	if (!bTargetActorResolved)
+	{
+		if (Data.Target.AbilityActorInfo.IsValid() && Data.Target.AbilityActorInfo->AvatarActor.IsValid())
+		{
+			TargetActor = Data.Target.AbilityActorInfo->AvatarActor.Get();
+		}
+
+		bTargetActorResolved = true;
+	}
+
+	return TargetActor;
+}
+
+APlayerController* FGSCAttributeSetExecutionContext::GetSourceController() const
+{
+	const UAbilitySystemComponent* SourceASC = GetSourceASC();
+	return SourceASC && SourceASC->AbilityActorInfo.IsValid() ? SourceASC->AbilityActorInfo->PlayerController.Get() : nullptr;
+}
+
+APlayerController* FGSCAttributeSetExecutionContext::GetTargetController() const
+{
+	return Data.Target.AbilityActorInfo.IsValid() ? Data.Target.AbilityActorInfo->PlayerController.Get() : nullptr;
+}
+
+APawn* FGSCAttributeSetExecutionContext::GetSourcePawn() const
+{
+	return Cast<APawn>(GetSourceActor());
+}
+
+APawn* FGSCAttributeSetExecutionContext::GetTargetPawn() const
+{
+	return Cast<APawn>(GetTargetActor());
+}
+
+UGSCCoreComponent* FGSCAttributeSetExecutionContext::GetSourceCoreComponent() const
+{
+	if (!bSourceCoreComponentResolved)
+	{
+		SourceCoreComponent = UGSCBlueprintFunctionLibrary::GetCompanionCoreComponent(GetSourceActor());
+		bSourceCoreComponentResolved = true;
+	}
+
+	return SourceCoreComponent;
+}
+
+UGSCCoreComponent* FGSCAttributeSetExecutionContext::GetTargetCoreComponent() const
+{
+	if (!bTargetCoreComponentResolved)
+	{
+		TargetCoreComponent = UGSCBlueprintFunctionLibrary::GetCompanionCoreComponent(GetTargetActor());
+		bTargetCoreComponentResolved = true;
+	}
+
+	return TargetCoreComponent;
+}
+
+void FGSCAttributeSetExecutionContext::ToExecutionData(FGSCAttributeSetExecutionData& OutExecutionData) const
+{
+	OutExecutionData.Context = GetContext();
+	OutExecutionData.SourceASC = GetSourceASC();
+	OutExecutionData.SourceTags = GetSourceTags();
+	OutExecutionData.SpecAssetTags = GetSpecAssetTags();
+
+	OutExecutionData.TargetActor = GetTargetActor();
+	OutExecutionData.TargetController = GetTargetController();
+	OutExecutionData.TargetPawn = GetTargetPawn();
+	OutExecutionData.TargetCoreComponent = GetTargetCoreComponent();
+
+	OutExecutionData.SourceActor = GetSourceActor();
+	OutExecutionData.SourceController = GetSourceController();
+	OutExecutionData.SourcePawn = GetSourcePawn();
+	OutExecutionData.SourceCoreComponent = GetSourceCoreComponent();
+
+	OutExecutionData.SourceObject = GetSourceObject();
+	OutExecutionData.DeltaValue = GetDeltaValue();
+}
+
 void UGSCAttributeSetBase::PostGameplayEffectExecute(const FGameplayEffectModCallbackData& Data)
 {
     Super::PostGameplayEffectExecute(Data);
 
-    AActor* SourceActor = nullptr;
-    AActor* TargetActor = nullptr;
-    GetSourceAndTargetFromContext<AActor>(Data, SourceActor, TargetActor);
+    const FGSCAttributeSetExecutionContext ExecutionContext(Data);
+    HandlePostGameplayEffectExecute(ExecutionContext);
+}
 
-    UGSCCoreComponent* TargetCoreComponent = UGSCBlueprintFunctionLibrary::GetCompanionCoreComponent(TargetActor);
-    if (TargetCoreComponent)
+void UGSCAttributeSetBase::HandlePostGameplayEffectExecute(const FGSCAttributeSetExecutionContext& ExecutionContext)
+{
+    if (UGSCCoreComponent* TargetCoreComponent = ExecutionContext.GetTargetCoreComponent())
     {
-        TargetCoreComponent->PostGameplayEffectExecute(this, Data);
+        TargetCoreComponent->PostGameplayEffectExecuteWithContext(this, ExecutionContext);
     }
 }
 
@@ -59,6 +176,11 @@ void UGSCAttributeSetBase::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>&
     Super::GetLifetimeReplicatedProps(OutLifetimeProps);
 }
 
+void UGSCAttributeSetBase::InitFromMetaDataTable(const UDataTable* DataTable)
+{
+	FGSCAttributeInitializationCache::Get().ApplyCompiledTable(this, DataTable);
+}
+
 float UGSCAttributeSetBase::GetClampMinimumValueFor(const FGameplayAttribute& Attribute)
 {
 	// Subclass are expected to override this method for anything other than 0.f (if GetClampMinimumValueFor() is even used)
@@ -97,48 +219,6 @@ void UGSCAttributeSetBase::AdjustAttributeForMaxChange(FGameplayAttributeData& A
 
 void UGSCAttributeSetBase::GetExecutionDataFromMod(const FGameplayEffectModCallbackData& Data, FGSCAttributeSetExecutionData& OutExecutionData)
 {
-	OutExecutionData.Context = Data.EffectSpec.GetContext();
-	OutExecutionData.SourceASC = OutExecutionData.Context.GetOriginalInstigatorAbilitySystemComponent();
-	OutExecutionData.SourceTags = *Data.EffectSpec.CapturedSourceTags.GetAggregatedTags();
-	Data.EffectSpec.GetAllAssetTags(OutExecutionData.SpecAssetTags);
-
-	OutExecutionData.TargetActor = Data.Target.AbilityActorInfo->AvatarActor.IsValid() ? Data.Target.AbilityActorInfo->AvatarActor.Get() : nullptr;
-	OutExecutionData.TargetController = Data.Target.AbilityActorInfo->PlayerController.IsValid() ? Data.Target.AbilityActorInfo->PlayerController.Get() : nullptr;
-	OutExecutionData.TargetPawn = Cast<APawn>(OutExecutionData.TargetActor);
-	OutExecutionData.TargetCoreComponent = UGSCBlueprintFunctionLibrary::GetCompanionCoreComponent(OutExecutionData.TargetActor);
-
-	if (OutExecutionData.SourceASC && OutExecutionData.SourceASC->AbilityActorInfo.IsValid())
-	{
-		// Get the Source actor, which should be the damage causer (instigator)
-		if (OutExecutionData.SourceASC->AbilityActorInfo->AvatarActor.IsValid())
-		{
-			// Set the source actor based on context if it's set
-			if (OutExecutionData.Context.GetEffectCauser())
-			{
-				OutExecutionData.SourceActor = OutExecutionData.Context.GetEffectCauser();
-			}
-			else
-			{
-				OutExecutionData.SourceActor = OutExecutionData.SourceASC->AbilityActorInfo->AvatarActor.IsValid()
-					? OutExecutionData.SourceASC->AbilityActorInfo->AvatarActor.Get()
-					: nullptr;
-			}
-		}
-
-		OutExecutionData.SourceController = OutExecutionData.SourceASC->AbilityActorInfo->PlayerController.IsValid()
-			? OutExecutionData.SourceASC->AbilityActorInfo->PlayerController.Get()
-			: nullptr;
-		OutExecutionData.SourcePawn = Cast<APawn>(OutExecutionData.SourceActor);
-		OutExecutionData.SourceCoreComponent = UGSCBlueprintFunctionLibrary::GetCompanionCoreComponent(OutExecutionData.SourceActor);
-	}
-
-	OutExecutionData.SourceObject = Data.EffectSpec.GetEffectContext().GetSourceObject();
-
-	// Compute the delta between old and new, if it is available
-	OutExecutionData.DeltaValue = 0.f;
-	if (Data.EvaluatedData.ModifierOp == EGameplayModOp::Type::Additive)
-	{
-		// If this was additive, store the raw delta value to be passed along later
-		OutExecutionData.DeltaValue = Data.EvaluatedData.Magnitude;
-	}
+	const FGSCAttributeSetExecutionContext ExecutionContext(Data);
+	ExecutionContext.ToExecutionData(OutExecutionData);
 }
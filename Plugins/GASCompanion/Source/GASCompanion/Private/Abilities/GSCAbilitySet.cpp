@@ -5,10 +5,12 @@
 #include "AbilitySystemComponent.h"
 #include "AbilitySystemGlobals.h"
 #include "GSCLog.h"
+#include "Abilities/GSCBlueprintFunctionLibrary.h"
 #include "Abilities/GSCAbilitySystemComponent.h"
 #include "Abilities/GSCAbilitySystemUtils.h"
 #include "Components/GSCAbilityInputBindingComponent.h"
 #include "Components/GSCCoreComponent.h"
+#include "Engine/AssetManager.h"
 #include "Runtime/Launch/Resources/Version.h"
 
 #define LOCTEXT_NAMESPACE "GSCAbilitySet"
@@ -81,6 +83,61 @@ bool UGSCAbilitySet::GrantToAbilitySystem(const AActor* InActor, FGSCAbilitySetH
 	return GrantToAbilitySystem(ASC, OutAbilitySetHandle, OutErrorText);
 }
 
+bool UGSCAbilitySet::GrantToAbilitySystems(const TArrayView<UAbilitySystemComponent* const> InASCs, TArray<FGSCAbilitySetHandle>& OutAbilitySetHandles, FText* OutErrorText, const bool bShouldRegisterCoreDelegates) const
+{
+	OutAbilitySetHandles.Reset(InASCs.Num());
+	OutAbilitySetHandles.SetNum(InASCs.Num());
+
+	TArray<UAbilitySystemComponent*> ValidASCs;
+	TArray<int32> ValidIndices;
+	ValidASCs.Reserve(InASCs.Num());
+	ValidIndices.Reserve(InASCs.Num());
+
+	for (int32 Index = 0; Index < InASCs.Num(); ++Index)
+	{
+		UAbilitySystemComponent* ASC = InASCs[Index];
+		if (!IsValid(ASC) || !ASC->IsA<UGSCAbilitySystemComponent>())
+		{
+			const FText ErrorMessage = FText::Format(LOCTEXT("Invalid_ASC_Batch", "ASC {0} at Index {1} is invalid or not a UGSCAbilitySystemComponent"), FText::FromString(GetNameSafe(ASC)), FText::AsNumber(Index));
+			if (OutErrorText)
+			{
+				*OutErrorText = ErrorMessage;
+			}
+
+			GSC_PLOG(Error, TEXT("%s"), *ErrorMessage.ToString());
+			continue;
+		}
+
+		ValidASCs.Add(ASC);
+		ValidIndices.Add(Index);
+	}
+
+	TArray<FGSCAbilitySetHandle> GrantedHandles;
+	if (!FGSCAbilitySystemUtils::TryGrantAbilitySetToMany(ValidASCs, this, GrantedHandles))
+	{
+		const FText ErrorMessage = FText::Format(LOCTEXT("Failed_Grant_Batch", "Failed to grant ability set {0} to {1} ASCs"), FText::FromString(GetNameSafe(this)), FText::AsNumber(ValidASCs.Num()));
+		if (OutErrorText)
+		{
+			*OutErrorText = ErrorMessage;
+		}
+
+		GSC_PLOG(Error, TEXT("%s"), *ErrorMessage.ToString());
+		return false;
+	}
+
+	for (int32 GrantedIndex = 0; GrantedIndex < ValidASCs.Num(); ++GrantedIndex)
+	{
+		OutAbilitySetHandles[ValidIndices[GrantedIndex]] = MoveTemp(GrantedHandles[GrantedIndex]);
+
+		if (bShouldRegisterCoreDelegates)
+		{
+			TryRegisterCoreComponentDelegates(ValidASCs[GrantedIndex]);
+		}
+	}
+
+	return ValidASCs.Num() == InASCs.Num();
+}
+
 bool UGSCAbilitySet::RemoveFromAbilitySystem(UAbilitySystemComponent* InASC, FGSCAbilitySetHandle& InAbilitySetHandle, FText* OutErrorText, const bool bShouldRegisterCoreDelegates)
 {
 	if (!IsValid(InASC))
@@ -108,7 +165,7 @@ bool UGSCAbilitySet::RemoveFromAbilitySystem(UAbilitySystemComponent* InASC, FGS
 	{
 		if (const AActor* AvatarActor = InASC->GetAvatarActor())
 		{
-			InputComponent = AvatarActor->FindComponentByClass<UGSCAbilityInputBindingComponent>();
+			InputComponent = UGSCBlueprintFunctionLibrary::GetAbilityInputBindingComponent(AvatarActor);
 		}
 	}
 	
@@ -211,6 +268,123 @@ bool UGSCAbilitySet::RemoveFromAbilitySystem(const AActor* InActor, FGSCAbilityS
 	return RemoveFromAbilitySystem(ASC, InAbilitySetHandle, OutErrorText);
 }
 
+TSharedRef<FGSCAbilitySetLoadHandle> UGSCAbilitySet::GrantToAbilitySystemAsync(UAbilitySystemComponent* InASC, const FGSCOnAbilitySetGranted& OnGranted, const bool bShouldRegisterCoreDelegates) const
+{
+	const TArray<TSoftObjectPtr<UGSCAbilitySet>> AbilitySets = { TSoftObjectPtr<UGSCAbilitySet>(FSoftObjectPath(this)) };
+
+	const TWeakObjectPtr<const UGSCAbilitySet> WeakThis(this);
+	const TWeakObjectPtr<UAbilitySystemComponent> WeakASC(InASC);
+
+	return LoadAbilitySetsAsync(AbilitySets, FSimpleDelegate::CreateLambda([WeakThis, WeakASC, OnGranted, bShouldRegisterCoreDelegates]()
+	{
+		const UGSCAbilitySet* AbilitySet = WeakThis.Get();
+		UAbilitySystemComponent* ASC = WeakASC.Get();
+
+		FGSCAbilitySetHandle Handle;
+		bool bSuccess = false;
+		if (AbilitySet && ASC)
+		{
+			// Everything is in memory at this point, LoadSynchronous() calls down the line resolve without hitting the disk
+			bSuccess = AbilitySet->GrantToAbilitySystem(ASC, Handle, nullptr, bShouldRegisterCoreDelegates);
+		}
+		else
+		{
+			GSC_LOG(Warning, TEXT("UGSCAbilitySet::GrantToAbilitySystemAsync - Ability Set or ASC got destroyed before the set finished loading"));
+		}
+
+		OnGranted.ExecuteIfBound(bSuccess, Handle);
+	}));
+}
+
+TSharedRef<FGSCAbilitySetLoadHandle> UGSCAbilitySet::LoadAbilitySetsAsync(const TArray<TSoftObjectPtr<UGSCAbilitySet>>& InAbilitySets, const FSimpleDelegate& OnLoaded)
+{
+	TSharedRef<FGSCAbilitySetLoadHandle> LoadHandle = MakeShared<FGSCAbilitySetLoadHandle>();
+
+	// Second step, once all the sets are in memory, batch their content in a single request
+	const TWeakPtr<FGSCAbilitySetLoadHandle> WeakLoadHandle = LoadHandle;
+	FSimpleDelegate LoadContent = FSimpleDelegate::CreateLambda([WeakLoadHandle, InAbilitySets, OnLoaded]()
+	{
+		const TSharedPtr<FGSCAbilitySetLoadHandle> PinnedLoadHandle = WeakLoadHandle.Pin();
+		if (!PinnedLoadHandle.IsValid())
+		{
+			// Handle was released in the meantime, load was cancelled
+			return;
+		}
+
+		TArray<FSoftObjectPath> ContentPaths;
+		for (const TSoftObjectPtr<UGSCAbilitySet>& AbilitySetEntry : InAbilitySets)
+		{
+			if (const UGSCAbilitySet* AbilitySet = AbilitySetEntry.Get())
+			{
+				AbilitySet->GetUnloadedSoftObjectPaths(ContentPaths);
+			}
+		}
+
+		if (ContentPaths.IsEmpty())
+		{
+			OnLoaded.ExecuteIfBound();
+			return;
+		}
+
+		// The streamable manager keeps in flight handles alive on its own, check ours wasn't released before completion
+		PinnedLoadHandle->ContentHandle = UAssetManager::GetStreamableManager().RequestAsyncLoad(ContentPaths, FStreamableDelegate::CreateLambda([WeakLoadHandle, OnLoaded]()
+		{
+			if (WeakLoadHandle.IsValid())
+			{
+				OnLoaded.ExecuteIfBound();
+			}
+		}));
+	});
+
+	TArray<FSoftObjectPath> AbilitySetPaths;
+	for (const TSoftObjectPtr<UGSCAbilitySet>& AbilitySetEntry : InAbilitySets)
+	{
+		if (!AbilitySetEntry.IsNull() && !AbilitySetEntry.Get())
+		{
+			AbilitySetPaths.AddUnique(AbilitySetEntry.ToSoftObjectPath());
+		}
+	}
+
+	if (AbilitySetPaths.IsEmpty())
+	{
+		LoadContent.Execute();
+	}
+	else
+	{
+		LoadHandle->AbilitySetsHandle = UAssetManager::GetStreamableManager().RequestAsyncLoad(AbilitySetPaths, LoadContent);
+	}
+
+	return LoadHandle;
+}
+
+void UGSCAbilitySet::GetUnloadedSoftObjectPaths(TArray<FSoftObjectPath>& OutPaths) const
+{
+	const auto AddIfUnloaded = [&OutPaths](const auto& SoftPtr)
+	{
+		if (!SoftPtr.IsNull() && !SoftPtr.Get())
+		{
+			OutPaths.AddUnique(SoftPtr.ToSoftObjectPath());
+		}
+	};
+
+	for (const FGSCGameFeatureAbilityMapping& AbilityMapping : GrantedAbilities)
+	{
+		AddIfUnloaded(AbilityMapping.AbilityType);
+		AddIfUnloaded(AbilityMapping.InputAction);
+	}
+
+	for (const FGSCGameFeatureAttributeSetMapping& AttributeSetMapping : GrantedAttributes)
+	{
+		AddIfUnloaded(AttributeSetMapping.AttributeSet);
+		AddIfUnloaded(AttributeSetMapping.InitializationData);
+	}
+
+	for (const FGSCGameFeatureGameplayEffectMapping& EffectMapping : GrantedEffects)
+	{
+		AddIfUnloaded(EffectMapping.EffectType);
+	}
+}
+
 bool UGSCAbilitySet::HasInputBinding() const
 {
 	for (const FGSCGameFeatureAbilityMapping& GrantedAbility : GrantedAbilities)
@@ -236,7 +410,7 @@ void UGSCAbilitySet::TryRegisterCoreComponentDelegates(UAbilitySystemComponent*
 	}
 
 	// UGSCCoreComponent could be added to avatars
-	if (UGSCCoreComponent* CoreComponent = AvatarActor->FindComponentByClass<UGSCCoreComponent>())
+	if (UGSCCoreComponent* CoreComponent = UGSCBlueprintFunctionLibrary::GetCompanionCoreComponent(AvatarActor))
 	{
 		// Make sure to notify we may have added attributes (on server)
 		CoreComponent->RegisterAbilitySystemDelegates(InASC);
@@ -259,7 +433,7 @@ void UGSCAbilitySet::TryUnregisterCoreComponentDelegates(UAbilitySystemComponent
 	}
 
 	// UGSCCoreComponent could be added to avatars
-	if (UGSCCoreComponent* CoreComponent = AvatarActor->FindComponentByClass<UGSCCoreComponent>())
+	if (UGSCCoreComponent* CoreComponent = UGSCBlueprintFunctionLibrary::GetCompanionCoreComponent(AvatarActor))
 	{
 		// Make sure to notify we may have removed attributes (on server)
 		CoreComponent->ShutdownAbilitySystemDelegates(InASC);
@@ -0,0 +1,223 @@
+// Copyright 2021 Mickael Daniel. All Rights Reserved.
+
+#include "Abilities/GSCAbilitySpecIndex.h"
+
+#include "Abilities/GameplayAbility.h"
+
+void FGSCAbilitySpecIndex::AddSpec(const FGameplayAbilitySpec& InSpec, const TArray<FGameplayAbilitySpec>& InItems)
+{
+	if (!InSpec.Ability || !InSpec.Handle.IsValid())
+	{
+		return;
+	}
+
+	FIndexedSpecs& Specs = SpecsByClass.FindOrAdd(InSpec.Ability->GetClass());
+	if (Specs.Contains(InSpec.Handle))
+	{
+		return;
+	}
+
+	FIndexedSpec& IndexedSpec = Specs.AddDefaulted_GetRef();
+	IndexedSpec.Handle = InSpec.Handle;
+	IndexedSpec.ItemIndex = InItems.IndexOfByPredicate([&InSpec](const FGameplayAbilitySpec& Item)
+	{
+		return Item.Handle == InSpec.Handle;
+	});
+
+	MarkInputIDsDirty();
+}
+
+void FGSCAbilitySpecIndex::RemoveSpec(const FGameplayAbilitySpec& InSpec)
+{
+	MarkInputIDsDirty();
+
+	if (!InSpec.Ability)
+	{
+		return;
+	}
+
+	const TObjectKey<UClass> ClassKey(InSpec.Ability->GetClass());
+	FIndexedSpecs* Specs = SpecsByClass.Find(ClassKey);
+	if (!Specs)
+	{
+		return;
+	}
+
+	Specs->RemoveAllSwap([&InSpec](const FIndexedSpec& IndexedSpec)
+	{
+		return IndexedSpec.Handle == InSpec.Handle;
+	});
+
+	if (Specs->IsEmpty())
+	{
+		SpecsByClass.Remove(ClassKey);
+	}
+}
+
+void FGSCAbilitySpecIndex::Reset()
+{
+	SpecsByClass.Reset();
+	SpecsByDenseInputID.Reset();
+	SpecsBySparseInputID.Reset();
+	bInputIDsDirty = true;
+}
+
+void FGSCAbilitySpecIndex::FindSpecsWithInputID(const TArray<FGameplayAbilitySpec>& InItems, const int32 InInputID, TArray<int32, TInlineAllocator<4>>& OutItemIndices)
+{
+	if (bInputIDsDirty)
+	{
+		RebuildInputIDs(InItems);
+	}
+
+	const FIndexedSpecs* Specs = FindSpecsByInputID(InInputID);
+	if (!Specs)
+	{
+		return;
+	}
+
+	for (const FIndexedSpec& IndexedSpec : *Specs)
+	{
+		const int32 ItemIndex = ResolveItemIndex(InItems, IndexedSpec);
+
+		// Skip over specs whose InputID was changed without the table being flagged dirty
+		if (ItemIndex != INDEX_NONE && InItems[ItemIndex].InputID == InInputID)
+		{
+			OutItemIndices.Add(ItemIndex);
+		}
+	}
+}
+
+FGameplayAbilitySpecHandle FGSCAbilitySpecIndex::FindSpecHandleByClassAndLevel(const TArray<FGameplayAbilitySpec>& InItems, const UClass* InAbilityClass, const int32 InLevel) const
+{
+	const FIndexedSpecs* Specs = InAbilityClass ? SpecsByClass.Find(InAbilityClass) : nullptr;
+	if (!Specs)
+	{
+		return FGameplayAbilitySpecHandle();
+	}
+
+	// Level can change after the spec was granted, so it is checked on the spec itself rather than being part of the key
+	for (const FIndexedSpec& IndexedSpec : *Specs)
+	{
+		const int32 ItemIndex = ResolveItemIndex(InItems, IndexedSpec);
+		if (ItemIndex != INDEX_NONE && InItems[ItemIndex].Level == InLevel)
+		{
+			return IndexedSpec.Handle;
+		}
+	}
+
+	return FGameplayAbilitySpecHandle();
+}
+
+void FGSCAbilitySpecIndex::RebuildInputIDs(const TArray<FGameplayAbilitySpec>& InItems)
+{
+	// Keep the array allocations around, InputIDs are rebuilt whenever a binding changes
+	for (FIndexedSpecs& Specs : SpecsByDenseInputID)
+	{
+		Specs.Reset();
+	}
+	SpecsBySparseInputID.Reset();
+
+	for (int32 ItemIndex = 0; ItemIndex < InItems.Num(); ++ItemIndex)
+	{
+		const FGameplayAbilitySpec& Spec = InItems[ItemIndex];
+		if (Spec.InputID == INDEX_NONE || !Spec.Handle.IsValid())
+		{
+			continue;
+		}
+
+		FIndexedSpecs* Specs;
+		if (Spec.InputID >= 0 && Spec.InputID < MaxDenseInputID)
+		{
+			if (!SpecsByDenseInputID.IsValidIndex(Spec.InputID))
+			{
+				SpecsByDenseInputID.SetNum(Spec.InputID + 1);
+			}
+
+			Specs = &SpecsByDenseInputID[Spec.InputID];
+		}
+		else
+		{
+			Specs = &SpecsBySparseInputID.FindOrAdd(Spec.InputID);
+		}
+
+		FIndexedSpec& IndexedSpec = Specs->AddDefaulted_GetRef();
+		IndexedSpec.Handle = Spec.Handle;
+		IndexedSpec.ItemIndex = ItemIndex;
+	}
+
+	bInputIDsDirty = false;
+}
+
+const FGSCAbilitySpecIndex::FIndexedSpecs* FGSCAbilitySpecIndex::FindSpecsByInputID(const int32 InInputID) const
+{
+	if (InInputID >= 0 && InInputID < MaxDenseInputID)
+	{
+		return SpecsByDenseInputID.IsValidIndex(InInputID) ? &SpecsByDenseInputID[InInputID] : nullptr;
+	}
+
+	return SpecsBySparseInputID.Find(InInputID);
+}
+
+void FGSCAbilitySpecIndex::ForEachActiveAbilityOfClass(const TArray<FGameplayAbilitySpec>& InItems, const TSubclassOf<UGameplayAbility> InAbilityClass, const TFunctionRef<bool(UGameplayAbility*)> InVisitor) const
+{
+	if (!InAbilityClass)
+	{
+		return;
+	}
+
+	for (const TPair<TObjectKey<UClass>, FIndexedSpecs>& Pair : SpecsByClass)
+	{
+		const UClass* AbilityClass = Pair.Key.ResolveObjectPtr();
+		if (!AbilityClass || !AbilityClass->IsChildOf(InAbilityClass))
+		{
+			continue;
+		}
+
+		for (const FIndexedSpec& IndexedSpec : Pair.Value)
+		{
+			const int32 ItemIndex = ResolveItemIndex(InItems, IndexedSpec);
+			if (ItemIndex != INDEX_NONE && !ForEachActiveAbilityInstance(InItems[ItemIndex], InVisitor))
+			{
+				return;
+			}
+		}
+	}
+}
+
+bool FGSCAbilitySpecIndex::ForEachActiveAbilityInstance(const FGameplayAbilitySpec& InSpec, const TFunctionRef<bool(UGameplayAbility*)> InVisitor)
+{
+	// Iterate both instance lists directly rather than GetAbilityInstances(), which returns a new array
+	for (UGameplayAbility* Instance : InSpec.ReplicatedInstances)
+	{
+		if (Instance && Instance->IsActive() && !InVisitor(Instance))
+		{
+			return false;
+		}
+	}
+
+	for (UGameplayAbility* Instance : InSpec.NonReplicatedInstances)
+	{
+		if (Instance && Instance->IsActive() && !InVisitor(Instance))
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+int32 FGSCAbilitySpecIndex::ResolveItemIndex(const TArray<FGameplayAbilitySpec>& InItems, const FIndexedSpec& InIndexedSpec)
+{
+	if (InItems.IsValidIndex(InIndexedSpec.ItemIndex) && InItems[InIndexedSpec.ItemIndex].Handle == InIndexedSpec.Handle)
+	{
+		return InIndexedSpec.ItemIndex;
+	}
+
+	// Items were reordered since last access, update the hint
+	InIndexedSpec.ItemIndex = InItems.IndexOfByPredicate([&InIndexedSpec](const FGameplayAbilitySpec& Item)
+	{
+		return Item.Handle == InIndexedSpec.Handle;
+	});
+
+	return InIndexedSpec.ItemIndex;
+}
@@ -3,8 +3,12 @@
 #include "Abilities/GSCAbilitySystemComponent.h"
 
 #include "GSCLog.h"
+#include "GSCStats.h"
+#include "Abilities/GSCAbilitySystemUtils.h"
 #include "Abilities/GSCBlueprintFunctionLibrary.h"
 #include "Abilities/GSCGameplayAbility_MeleeBase.h"
+#include "Abilities/GSCInputLatencyTracker.h"
+#include "Abilities/Attributes/GSCAttributeInitializationCache.h"
 #include "Animation/AnimInstance.h"
 #include "Animations/GSCNativeAnimInstanceInterface.h"
 #include "Components/GSCAbilityInputBindingComponent.h"
@@ -14,6 +18,16 @@
 #include "Engine/GameInstance.h"
 #include "Runtime/Launch/Resources/Version.h"
 
+void UGSCAbilitySystemComponent::OnRegister()
+{
+	Super::OnRegister();
+
+	if (bPreloadAbilitySets && !GrantedAbilitySets.IsEmpty() && GetWorld() && GetWorld()->IsGameWorld() && !AbilitySetsPreloadHandle.IsValid())
+	{
+		AbilitySetsPreloadHandle = UGSCAbilitySet::LoadAbilitySetsAsync(GrantedAbilitySets, FSimpleDelegate());
+	}
+}
+
 void UGSCAbilitySystemComponent::BeginPlay()
 {
 	Super::BeginPlay();
@@ -21,6 +35,7 @@ void UGSCAbilitySystemComponent::BeginPlay()
 	AbilityActivatedCallbacks.AddUObject(this, &UGSCAbilitySystemComponent::OnAbilityActivatedCallback);
 	AbilityFailedCallbacks.AddUObject(this, &UGSCAbilitySystemComponent::OnAbilityFailedCallback);
 	AbilityEndedCallbacks.AddUObject(this, &UGSCAbilitySystemComponent::OnAbilityEndedCallback);
+	CooldownTracker.Initialize(this);
 
 	// Grant startup effects on begin play instead of from within InitAbilityActorInfo to avoid
 	// "ticking" periodic effects when BP is first opened
@@ -41,6 +56,9 @@ void UGSCAbilitySystemComponent::BeginDestroy()
 	}
 
 	OnGiveAbilityDelegate.RemoveAll(this);
+	OnAbilitySpecsChangedDelegate.Clear();
+	OnAnyAttributeValueChangeDelegate.Clear();
+	CooldownTracker.Deinitialize();
 
 	// Remove any added attributes
 	for (UAttributeSet* AttribSetInstance : AddedAttributes)
@@ -53,7 +71,7 @@ void UGSCAbilitySystemComponent::BeginDestroy()
 	}
 
 	// Clear up abilities / bindings
-	UGSCAbilityInputBindingComponent* InputComponent = AbilityActorInfo && AbilityActorInfo->AvatarActor.IsValid() ? AbilityActorInfo->AvatarActor->FindComponentByClass<UGSCAbilityInputBindingComponent>() : nullptr;
+	UGSCAbilityInputBindingComponent* InputComponent = AbilityActorInfo && AbilityActorInfo->AvatarActor.IsValid() ? UGSCBlueprintFunctionLibrary::GetAbilityInputBindingComponent(AbilityActorInfo->AvatarActor.Get()) : nullptr;
 
 	for (const FGSCMappedAbility& DefaultAbilityHandle : AddedAbilityHandles)
 	{
@@ -70,7 +88,7 @@ void UGSCAbilitySystemComponent::BeginDestroy()
 	}
 
 	// Clear up any bound delegates in Core Component that were registered from InitAbilityActorInfo
-	UGSCCoreComponent* CoreComponent = AbilityActorInfo && AbilityActorInfo->AvatarActor.IsValid() ? AbilityActorInfo->AvatarActor->FindComponentByClass<UGSCCoreComponent>() : nullptr;
+	UGSCCoreComponent* CoreComponent = AbilityActorInfo && AbilityActorInfo->AvatarActor.IsValid() ? UGSCBlueprintFunctionLibrary::GetCompanionCoreComponent(AbilityActorInfo->AvatarActor.Get()) : nullptr;
 	if (CoreComponent)
 	{
 		CoreComponent->ShutdownAbilitySystemDelegates(this);
@@ -80,10 +98,40 @@ void UGSCAbilitySystemComponent::BeginDestroy()
 	AddedAttributes.Reset();
 	AddedEffects.Reset();
 	AddedAbilitySets.Reset();
+	AbilitySpecIndex.Reset();
+
+	if (AbilitySetsLoadHandle.IsValid())
+	{
+		AbilitySetsLoadHandle->CancelHandle();
+		AbilitySetsLoadHandle.Reset();
+	}
+
+	AbilitySetsPreloadHandle.Reset();
 
 	Super::BeginDestroy();
 }
 
+void UGSCAbilitySystemComponent::RegisterAttributeChangeDispatcher()
+{
+	TArray<FGameplayAttribute> Attributes;
+	GetAllAttributes(Attributes);
+
+	for (const FGameplayAttribute& Attribute : Attributes)
+	{
+		bool bAlreadyDispatched = false;
+		DispatchedAttributes.Add(Attribute, &bAlreadyDispatched);
+		if (!bAlreadyDispatched)
+		{
+			GetGameplayAttributeValueChangeDelegate(Attribute).AddUObject(this, &UGSCAbilitySystemComponent::DispatchAttributeValueChange);
+		}
+	}
+}
+
+void UGSCAbilitySystemComponent::DispatchAttributeValueChange(const FOnAttributeChangeData& Data) const
+{
+	OnAnyAttributeValueChangeDelegate.Broadcast(Data);
+}
+
 void UGSCAbilitySystemComponent::InitAbilityActorInfo(AActor* InOwnerActor, AActor* InAvatarActor)
 {
 	Super::InitAbilityActorInfo(InOwnerActor, InAvatarActor);
@@ -123,6 +171,7 @@ void UGSCAbilitySystemComponent::InitAbilityActorInfo(AActor* InOwnerActor, AAct
 
 	GrantDefaultAbilitiesAndAttributes(InOwnerActor, InAvatarActor);
 	GrantDefaultAbilitySets(InOwnerActor, InAvatarActor);
+	RegisterAttributeChangeDispatcher();
 
 	// For PlayerState client pawns, setup and update owner on companion components if pawns have them
 	UGSCCoreComponent* CoreComponent = UGSCBlueprintFunctionLibrary::GetCompanionCoreComponent(InAvatarActor);
@@ -146,6 +195,8 @@ void UGSCAbilitySystemComponent::InitAbilityActorInfo(AActor* InOwnerActor, AAct
 
 void UGSCAbilitySystemComponent::AbilityLocalInputPressed(const int32 InputID)
 {
+	FGSCInputLatencyTracker::Get().MarkStage(this, EGSCInputLatencyStage::AbilityInput);
+
 	// Consume the input if this InputID is overloaded with GenericConfirm/Cancel and the GenericConfim/Cancel callback is bound
 	if (IsGenericConfirmInputBound(InputID))
 	{
@@ -162,9 +213,14 @@ void UGSCAbilitySystemComponent::AbilityLocalInputPressed(const int32 InputID)
 	// ---------------------------------------------------------
 
 	ABILITYLIST_SCOPE_LOCK();
-	for (FGameplayAbilitySpec& Spec : ActivatableAbilities.Items)
+
+	TArray<int32, TInlineAllocator<4>> SpecIndices;
+	AbilitySpecIndex.FindSpecsWithInputID(ActivatableAbilities.Items, InputID, SpecIndices);
+
+	for (const int32 SpecIndex : SpecIndices)
 	{
-		if (Spec.InputID == InputID && Spec.Ability)
+		FGameplayAbilitySpec& Spec = ActivatableAbilities.Items[SpecIndex];
+		if (Spec.Ability)
 		{
 			Spec.InputPressed = true;
 
@@ -185,6 +241,7 @@ void UGSCAbilitySystemComponent::AbilityLocalInputPressed(const int32 InputID)
 				if (IsValid(ComboComponent))
 				{
 					// We have a valid combo component, active combo
+					FGSCInputLatencyTracker::Get().MarkStage(this, EGSCInputLatencyStage::ComboGating);
 					ComboComponent->ActivateComboAbility(Spec.Ability->GetClass());
 				}
 				else
@@ -209,6 +266,7 @@ void UGSCAbilitySystemComponent::AbilityLocalInputPressed(const int32 InputID)
 				}
 				else
 				{
+					FGSCInputLatencyTracker::Get().MarkStage(this, EGSCInputLatencyStage::ActivationRequested);
 					TryActivateAbility(Spec.Handle);
 				}
 			}
@@ -216,6 +274,33 @@ void UGSCAbilitySystemComponent::AbilityLocalInputPressed(const int32 InputID)
 	}
 }
 
+void UGSCAbilitySystemComponent::AbilityLocalInputReleased(const int32 InputID)
+{
+	ABILITYLIST_SCOPE_LOCK();
+
+	TArray<int32, TInlineAllocator<4>> SpecIndices;
+	AbilitySpecIndex.FindSpecsWithInputID(ActivatableAbilities.Items, InputID, SpecIndices);
+
+	for (const int32 SpecIndex : SpecIndices)
+	{
+		FGameplayAbilitySpec& Spec = ActivatableAbilities.Items[SpecIndex];
+		Spec.InputPressed = false;
+
+		if (Spec.Ability && Spec.IsActive())
+		{
+			if (Spec.Ability->bReplicateInputDirectly && IsOwnerActorAuthoritative() == false)
+			{
+				ServerSetInputReleased(Spec.Handle);
+			}
+
+			AbilitySpecInputReleased(Spec);
+
+			// Invoke the InputReleased event. This is not replicated here. If someone is listening, they may replicate the InputReleased event to the server.
+			InvokeReplicatedEvent(EAbilityGenericReplicatedEvent::InputReleased, Spec.Handle, Spec.ActivationInfo.GetActivationPredictionKey());
+		}
+	}
+}
+
 FGameplayAbilitySpecHandle UGSCAbilitySystemComponent::GrantAbility(const TSubclassOf<UGameplayAbility> Ability, const bool bRemoveAfterActivation)
 {
 	FGameplayAbilitySpecHandle AbilityHandle;
@@ -276,6 +361,8 @@ bool UGSCAbilitySystemComponent::ClearAbilitySet(FGSCAbilitySetHandle& InAbility
 void UGSCAbilitySystemComponent::OnAbilityActivatedCallback(UGameplayAbility* Ability)
 {
 	GSC_LOG(Log, TEXT("UGSCAbilitySystemComponent::OnAbilityActivatedCallback %s"), *Ability->GetName());
+	FGSCInputLatencyTracker::Get().OnAbilityActivated(this, Ability);
+
 	const AActor* Avatar = GetAvatarActor();
 	if (!Avatar)
 	{
@@ -346,21 +433,7 @@ bool UGSCAbilitySystemComponent::ShouldGrantAbility(const TSubclassOf<UGameplayA
 	}
 
 	// Check for activatable abilities, if one is matching the given Ability type, prevent re adding again
-	TArray<FGameplayAbilitySpec> AbilitySpecs = GetActivatableAbilities();
-	for (const FGameplayAbilitySpec& ActivatableAbility : AbilitySpecs)
-	{
-		if (!ActivatableAbility.Ability)
-		{
-			continue;
-		}
-
-		if (ActivatableAbility.Ability->GetClass() == InAbility && ActivatableAbility.Level == InLevel)
-		{
-			return false;
-		}
-	}
-
-	return true;
+	return !FindAbilitySpecHandleFromClassAndLevel(InAbility, InLevel).IsValid();
 }
 
 bool UGSCAbilitySystemComponent::ShouldGrantAbilitySet(const UGSCAbilitySet* InAbilitySet) const
@@ -389,11 +462,21 @@ void UGSCAbilitySystemComponent::GrantDefaultAbilitiesAndAttributes(AActor* InOw
 {
 	GSC_WLOG(Verbose, TEXT("Owner: %s, Avatar: %s"), *GetNameSafe(InOwnerActor), *GetNameSafe(InAvatarActor))
 
+	// Attribute sets kept around to be reset in place below, instead of being reallocated
+	TArray<UAttributeSet*, TInlineAllocator<4>> PooledAttributes;
+
 	if (bResetAttributesOnSpawn)
 	{
 		// Reset/Remove abilities if we had already added them
 		for (UAttributeSet* AttributeSet : AddedAttributes)
 		{
+			// Only pool sets still registered with the ASC and outered to the same owner
+			if (bPoolAttributeSetsOnSpawn && IsValid(AttributeSet) && AttributeSet->GetOuter() == InOwnerActor && GetSpawnedAttributes().Contains(AttributeSet))
+			{
+				PooledAttributes.Add(AttributeSet);
+				continue;
+			}
+
 #if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 1
 			RemoveSpawnedAttribute(AttributeSet);
 #else
@@ -423,7 +506,7 @@ void UGSCAbilitySystemComponent::GrantDefaultAbilitiesAndAttributes(AActor* InOw
 		InputBindingDelegateHandles.Empty();
 	}
 
-	UGSCAbilityInputBindingComponent* InputComponent = IsValid(InAvatarActor) ? InAvatarActor->FindComponentByClass<UGSCAbilityInputBindingComponent>() : nullptr;
+	UGSCAbilityInputBindingComponent* InputComponent = IsValid(InAvatarActor) ? UGSCBlueprintFunctionLibrary::GetAbilityInputBindingComponent(InAvatarActor) : nullptr;
 
 	// Startup abilities
 	// ReSharper disable once CppUseStructuredBinding
@@ -471,6 +554,21 @@ void UGSCAbilitySystemComponent::GrantDefaultAbilitiesAndAttributes(AActor* InOw
 	{
 		if (AttributeSetDefinition.AttributeSet)
 		{
+			const int32 PooledIndex = PooledAttributes.IndexOfByPredicate([&AttributeSetDefinition](const UAttributeSet* AttributeSet)
+			{
+				return AttributeSet->GetClass() == AttributeSetDefinition.AttributeSet;
+			});
+
+			if (PooledIndex != INDEX_NONE)
+			{
+				UAttributeSet* AttributeSet = PooledAttributes[PooledIndex];
+				PooledAttributes.RemoveAtSwap(PooledIndex);
+
+				FGSCAbilitySystemUtils::ResetAttributeSet(AttributeSet, AttributeSetDefinition.InitializationData);
+				AddedAttributes.Add(AttributeSet);
+				continue;
+			}
+
 			const bool bHasAttributeSet = GetAttributeSubobject(AttributeSetDefinition.AttributeSet) != nullptr;
 			GSC_LOG(
 				Verbose,
@@ -483,15 +581,27 @@ void UGSCAbilitySystemComponent::GrantDefaultAbilitiesAndAttributes(AActor* InOw
 			if (!bHasAttributeSet && InOwnerActor)
 			{
 				UAttributeSet* AttributeSet = NewObject<UAttributeSet>(InOwnerActor, AttributeSetDefinition.AttributeSet);
+				INC_DWORD_STAT(STAT_GSC_AttributeSetsAllocated);
+
 				if (AttributeSetDefinition.InitializationData)
 				{
-					AttributeSet->InitFromMetaDataTable(AttributeSetDefinition.InitializationData);
+					FGSCAttributeInitializationCache::Get().InitAttributeSet(AttributeSet, AttributeSetDefinition.InitializationData);
 				}
 				AddedAttributes.Add(AttributeSet);
 				AddAttributeSetSubobject(AttributeSet);
 			}
 		}
 	}
+
+	// Pooled sets no longer part of GrantedAttributes are removed, as they would have been without pooling
+	for (UAttributeSet* AttributeSet : PooledAttributes)
+	{
+#if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 1
+		RemoveSpawnedAttribute(AttributeSet);
+#else
+		GetSpawnedAttributes_Mutable().Remove(AttributeSet);
+#endif
+	}
 }
 
 void UGSCAbilitySystemComponent::GrantDefaultAbilitySets(AActor* InOwnerActor, AActor* InAvatarActor)
@@ -503,65 +613,175 @@ void UGSCAbilitySystemComponent::GrantDefaultAbilitySets(AActor* InOwnerActor, A
 		return;
 	}
 
+	if (bGrantAbilitySetsAsync)
+	{
+		// InitAbilityActorInfo runs several times, a load already in flight grants the sets to the latest avatar once done
+		if (AbilitySetsLoadHandle.IsValid() && AbilitySetsLoadHandle->IsLoadingInProgress())
+		{
+			return;
+		}
+
+		// Invokes OnDefaultAbilitySetsLoaded right away if everything is already in memory
+		AbilitySetsLoadHandle = UGSCAbilitySet::LoadAbilitySetsAsync(GrantedAbilitySets, FSimpleDelegate::CreateUObject(this, &UGSCAbilitySystemComponent::OnDefaultAbilitySetsLoaded));
+		return;
+	}
+
 	for (const TSoftObjectPtr<UGSCAbilitySet>& AbilitySetEntry : GrantedAbilitySets)
 	{
 		if (const UGSCAbilitySet* AbilitySet = AbilitySetEntry.LoadSynchronous())
 		{
-			if (!ShouldGrantAbilitySet(AbilitySet))
+			if (!GrantDefaultAbilitySet(AbilitySet, InAvatarActor))
 			{
-				continue;
+				return;
 			}
-			
-			// Check for input bindings, if we need some, then ensure AvatarActor has the required component to issue a warning if not
-			//
-			// This also take care of order of initialization in case of Player State characters. On first invocation from InitializeComponent(), the Avatar Actor is likely
-			// not yet set and points to owner actor (PlayerState). This is only after ACharacter::PossessedBy() that proper Avatar Actor is set, thus allowing us to get back
-			// the Input Binding component and set up the ability bindings.
-
-			// If the set doesn't have any Ability with bindings, then we can grant early.
-			if (AbilitySet->HasInputBinding())
-			{
-				// Binding will only ever happen on Pawn actors, not when AvatarActor is set to PlayerState early on in initialization order
-				const APawn* AvatarPawn = Cast<APawn>(InAvatarActor);
-				if (!AvatarPawn)
-				{
-					// Try next time
-					return;
-				}
+		}
+	}
 
-				const UGSCAbilityInputBindingComponent* InputBindingComponent = AvatarPawn->FindComponentByClass<UGSCAbilityInputBindingComponent>();
-				if (!InputBindingComponent)
-				{
-					const FText FormatText = NSLOCTEXT(
-						"GSCAbilitySystemComponent",
-						"Error_AbilitySet_Invalid_InputBindingComponent",
-						"The set contains Abilities with Input bindings but {0} is missing the required UGSCAbilityInputBindingComponent actor component."
-					);
-
-					const FText ErrorText = FText::Format(FormatText, FText::FromString(AvatarPawn->GetName()));
-					GSC_PLOG(Error, TEXT("Error trying to grant ability set %s - %s"), *GetNameSafe(AbilitySet), *ErrorText.ToString());
-					return;
-				}
-			}
-			
-			FText ErrorText;
-			FGSCAbilitySetHandle Handle;
-			if (!AbilitySet->GrantToAbilitySystem(this, Handle, &ErrorText, false))
+	OnDefaultAbilitySetsGranted.Broadcast();
+}
+
+void UGSCAbilitySystemComponent::OnDefaultAbilitySetsLoaded()
+{
+	AActor* OwnerActor = AbilityActorInfo.IsValid() ? AbilityActorInfo->OwnerActor.Get() : nullptr;
+	AActor* AvatarActor = AbilityActorInfo.IsValid() ? AbilityActorInfo->AvatarActor.Get() : nullptr;
+
+	GSC_WLOG(Verbose, TEXT("Ability Sets loaded - OwnerActor: %s, AvatarActor: %s"), *GetNameSafe(OwnerActor), *GetNameSafe(AvatarActor))
+
+	if (!IsValid(OwnerActor) || !IsValid(AvatarActor))
+	{
+		return;
+	}
+
+	for (const TSoftObjectPtr<UGSCAbilitySet>& AbilitySetEntry : GrantedAbilitySets)
+	{
+		if (const UGSCAbilitySet* AbilitySet = AbilitySetEntry.Get())
+		{
+			if (!GrantDefaultAbilitySet(AbilitySet, AvatarActor))
 			{
-				GSC_PLOG(Error, TEXT("Error trying to grant ability set %s - %s"), *GetNameSafe(AbilitySet), *ErrorText.ToString());
-				continue;
+				return;
 			}
+		}
+	}
+
+	// Sets may have added attributes after InitAbilityActorInfo, listeners are bound to the dispatcher so binding it is enough
+	RegisterAttributeChangeDispatcher();
+
+	OnDefaultAbilitySetsGranted.Broadcast();
+}
+
+bool UGSCAbilitySystemComponent::GrantDefaultAbilitySet(const UGSCAbilitySet* InAbilitySet, AActor* InAvatarActor)
+{
+	check(InAbilitySet);
 
-			AddedAbilitySets.AddUnique(Handle);
+	if (!ShouldGrantAbilitySet(InAbilitySet))
+	{
+		return true;
+	}
+	
+	// Check for input bindings, if we need some, then ensure AvatarActor has the required component to issue a warning if not
+	//
+	// This also take care of order of initialization in case of Player State characters. On first invocation from InitializeComponent(), the Avatar Actor is likely
+	// not yet set and points to owner actor (PlayerState). This is only after ACharacter::PossessedBy() that proper Avatar Actor is set, thus allowing us to get back
+	// the Input Binding component and set up the ability bindings.
+
+	// If the set doesn't have any Ability with bindings, then we can grant early.
+	if (InAbilitySet->HasInputBinding())
+	{
+		// Binding will only ever happen on Pawn actors, not when AvatarActor is set to PlayerState early on in initialization order
+		const APawn* AvatarPawn = Cast<APawn>(InAvatarActor);
+		if (!AvatarPawn)
+		{
+			// Try next time
+			return false;
 		}
+
+		const UGSCAbilityInputBindingComponent* InputBindingComponent = UGSCBlueprintFunctionLibrary::GetAbilityInputBindingComponent(AvatarPawn);
+		if (!InputBindingComponent)
+		{
+			const FText FormatText = NSLOCTEXT(
+				"GSCAbilitySystemComponent",
+				"Error_AbilitySet_Invalid_InputBindingComponent",
+				"The set contains Abilities with Input bindings but {0} is missing the required UGSCAbilityInputBindingComponent actor component."
+			);
+
+			const FText ErrorText = FText::Format(FormatText, FText::FromString(AvatarPawn->GetName()));
+			GSC_PLOG(Error, TEXT("Error trying to grant ability set %s - %s"), *GetNameSafe(InAbilitySet), *ErrorText.ToString());
+			return false;
+		}
+	}
+	
+	FText ErrorText;
+	FGSCAbilitySetHandle Handle;
+	if (!InAbilitySet->GrantToAbilitySystem(this, Handle, &ErrorText, false))
+	{
+		GSC_PLOG(Error, TEXT("Error trying to grant ability set %s - %s"), *GetNameSafe(InAbilitySet), *ErrorText.ToString());
+		return true;
 	}
+
+	AddedAbilitySets.AddUnique(Handle);
+	return true;
 }
 
 void UGSCAbilitySystemComponent::OnGiveAbility(FGameplayAbilitySpec& AbilitySpec)
 {
 	Super::OnGiveAbility(AbilitySpec);
 	GSC_WLOG(Verbose, TEXT("%s"), *AbilitySpec.GetDebugString());
+	AbilitySpecIndex.AddSpec(AbilitySpec, ActivatableAbilities.Items);
 	OnGiveAbilityDelegate.Broadcast(AbilitySpec);
+	OnAbilitySpecsChangedDelegate.Broadcast();
+}
+
+void UGSCAbilitySystemComponent::OnRemoveAbility(FGameplayAbilitySpec& AbilitySpec)
+{
+	AbilitySpecIndex.RemoveSpec(AbilitySpec);
+	Super::OnRemoveAbility(AbilitySpec);
+	OnAbilitySpecsChangedDelegate.Broadcast();
+}
+
+bool UGSCAbilitySystemComponent::HasActiveAbilityOfClass(const TSubclassOf<UGameplayAbility> InAbilityClass) const
+{
+	bool bFound = false;
+	ForEachActiveAbilityOfClass(InAbilityClass, [&bFound](UGameplayAbility*)
+	{
+		bFound = true;
+		return false;
+	});
+
+	return bFound;
+}
+
+void UGSCAbilitySystemComponent::ForEachActiveAbilityOfClass(const TSubclassOf<UGameplayAbility> InAbilityClass, const TFunctionRef<bool(UGameplayAbility*)> InVisitor) const
+{
+	AbilitySpecIndex.ForEachActiveAbilityOfClass(ActivatableAbilities.Items, InAbilityClass, InVisitor);
+}
+
+FGameplayAbilitySpecHandle UGSCAbilitySystemComponent::FindAbilitySpecHandleFromClassAndLevel(const TSubclassOf<UGameplayAbility> InAbilityClass, const int32 InLevel) const
+{
+	return AbilitySpecIndex.FindSpecHandleByClassAndLevel(ActivatableAbilities.Items, InAbilityClass, InLevel);
+}
+
+void UGSCAbilitySystemComponent::MarkAbilitySpecInputIDsDirty()
+{
+	AbilitySpecIndex.MarkInputIDsDirty();
+}
+
+bool UGSCAbilitySystemComponent::GetAbilityCooldownRemaining(const FGameplayAbilitySpecHandle AbilitySpecHandle, float& TimeRemaining, float& Duration) const
+{
+	return CooldownTracker.GetCooldownRemaining(AbilitySpecHandle, TimeRemaining, Duration);
+}
+
+bool UGSCAbilitySystemComponent::GetAbilityCooldownRemainingForClass(const TSubclassOf<UGameplayAbility> AbilityClass, float& TimeRemaining, float& Duration) const
+{
+	return CooldownTracker.GetCooldownRemainingForClass(AbilityClass, TimeRemaining, Duration);
+}
+
+void UGSCAbilitySystemComponent::OnRep_ActivateAbilities()
+{
+	Super::OnRep_ActivateAbilities();
+
+	// Replicated spec changes may have overridden InputIDs set locally
+	AbilitySpecIndex.MarkInputIDsDirty();
+	OnAbilitySpecsChangedDelegate.Broadcast();
 }
 
 void UGSCAbilitySystemComponent::GrantStartupEffects()
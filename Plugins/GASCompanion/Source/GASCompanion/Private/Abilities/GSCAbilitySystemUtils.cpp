@@ -3,171 +3,122 @@
 #include "Abilities/GSCAbilitySystemUtils.h"
 
 #include "GSCLog.h"
+#include "GSCStats.h"
+#include "Abilities/GSCBlueprintFunctionLibrary.h"
 #include "Abilities/GSCAbilitySystemComponent.h"
+#include "Abilities/Attributes/GSCAttributeInitializationCache.h"
 #include "Components/GSCAbilityInputBindingComponent.h"
 #include "Components/GameFrameworkComponentManager.h"
 #include "Engine/GameInstance.h"
 
-void FGSCAbilitySystemUtils::TryGrantAbility(UAbilitySystemComponent* InASC, const FGSCGameFeatureAbilityMapping& InAbilityMapping, FGameplayAbilitySpecHandle& OutAbilityHandle, FGameplayAbilitySpec& OutAbilitySpec)
+bool FGSCResolvedAbilitySet::Resolve(const UGSCAbilitySet* InAbilitySet)
 {
-	check(InASC);
-	
-	if (InAbilityMapping.AbilityType.IsNull())
+	if (!InAbilitySet)
 	{
-		GSC_PLOG(Error, TEXT("Failed to Grant Ability \"%s\" because SoftClassPtr is null"), *InAbilityMapping.AbilityType.ToString())
-		return;
+		return false;
 	}
-	
-	const TSubclassOf<UGameplayAbility> AbilityType = InAbilityMapping.AbilityType.LoadSynchronous();
-	check(AbilityType);
 
-	UGSCAbilitySystemComponent* ASC = Cast<UGSCAbilitySystemComponent>(InASC);
-	if (!ASC)
-	{
-		GSC_PLOG(Error, TEXT("Failed to Grant Ability \"%s\" because ASC \"%s\" is not a UGSCAbilitySystemComponent"), *GetNameSafe(AbilityType), *GetNameSafe(InASC))
-		return;
-	}
+	Abilities.Reset(InAbilitySet->GrantedAbilities.Num());
+	Attributes.Reset(InAbilitySet->GrantedAttributes.Num());
+	Effects.Reset(InAbilitySet->GrantedEffects.Num());
 
-	OutAbilitySpec = ASC->BuildAbilitySpecFromClass(AbilityType, InAbilityMapping.Level);
-	
-	// Try to grant the ability first
-	if (ASC->IsOwnerActorAuthoritative())
+	int32 AbilitiesIndex = 0;
+	for (const FGSCGameFeatureAbilityMapping& AbilityMapping : InAbilitySet->GrantedAbilities)
 	{
-		// Only Grant abilities on authority, and only if we should (ability not granted yet or wants reset on spawn)
-		if (!IsAbilityGranted(ASC, AbilityType, InAbilityMapping.Level))
+		AbilitiesIndex++;
+
+		const TSubclassOf<UGameplayAbility> AbilityType = AbilityMapping.AbilityType.LoadSynchronous();
+		if (!AbilityType)
 		{
-			GSC_PLOG(Verbose, TEXT("Authority, Grant Ability (%s)"), *AbilityType->GetName())
-			OutAbilityHandle = ASC->GiveAbility(OutAbilitySpec);
+			GSC_PLOG(Error, TEXT("GrantedAbilities AbilityType on ability set %s is not valid at Index %d"), *GetNameSafe(InAbilitySet), AbilitiesIndex - 1);
+			continue;
 		}
-		else
+
+		FAbility& Ability = Abilities.AddDefaulted_GetRef();
+		Ability.AbilityType = AbilityType;
+		Ability.Level = AbilityMapping.Level;
+		Ability.InputAction = AbilityMapping.InputAction.LoadSynchronous();
+		Ability.TriggerEvent = AbilityMapping.TriggerEvent;
+	}
+
+	int32 AttributesIndex = 0;
+	for (const FGSCGameFeatureAttributeSetMapping& AttributeSetMapping : InAbilitySet->GrantedAttributes)
+	{
+		AttributesIndex++;
+
+		const TSubclassOf<UAttributeSet> AttributeSetType = AttributeSetMapping.AttributeSet.LoadSynchronous();
+		if (!AttributeSetType)
 		{
-			// In case granting is prevented because of ability already existing, return the existing handle
-			const FGameplayAbilitySpec* ExistingAbilitySpec = ASC->FindAbilitySpecFromClass(AbilityType);
-			if (ExistingAbilitySpec)
-			{
-				OutAbilityHandle = ExistingAbilitySpec->Handle;
-			}
+			GSC_PLOG(Error, TEXT("GrantedAttributes AttributeSet on ability set %s is not valid at Index %d"), *GetNameSafe(InAbilitySet), AttributesIndex - 1);
+			continue;
 		}
+
+		FAttributeSet& AttributeSet = Attributes.AddDefaulted_GetRef();
+		AttributeSet.AttributeSetType = AttributeSetType;
+		AttributeSet.InitializationData = AttributeSetMapping.InitializationData.LoadSynchronous();
 	}
-	else
+
+	int32 EffectsIndex = 0;
+	for (const FGSCGameFeatureGameplayEffectMapping& EffectMapping : InAbilitySet->GrantedEffects)
 	{
-		// For clients, try to get ability spec and update handle used later on for input binding
-		const FGameplayAbilitySpec* ExistingAbilitySpec = ASC->FindAbilitySpecFromClass(AbilityType);
-		if (ExistingAbilitySpec)
+		EffectsIndex++;
+
+		const TSubclassOf<UGameplayEffect> EffectType = EffectMapping.EffectType.LoadSynchronous();
+		if (!EffectType)
 		{
-			OutAbilityHandle = ExistingAbilitySpec->Handle;
+			GSC_PLOG(Error, TEXT("GrantedEffects EffectType on ability set %s is not valid at Index %d"), *GetNameSafe(InAbilitySet), EffectsIndex - 1);
+			continue;
 		}
-		
-		GSC_LOG(Verbose, TEXT("AddActorAbilities: Not Authority, try to find ability handle from spec: %s"), *OutAbilityHandle.ToString())
+
+		FEffect& Effect = Effects.AddDefaulted_GetRef();
+		Effect.EffectType = EffectType;
+		Effect.Level = EffectMapping.Level;
 	}
+
+	OwnedTags = InAbilitySet->OwnedTags;
+	AbilitySetPathName = InAbilitySet->GetPathName();
+	return true;
 }
 
-void FGSCAbilitySystemUtils::TryBindAbilityInput(UAbilitySystemComponent* InASC, const FGSCGameFeatureAbilityMapping& InAbilityMapping, const FGameplayAbilitySpecHandle& InAbilityHandle, const FGameplayAbilitySpec& InAbilitySpec, FDelegateHandle& OutOnGiveAbilityDelegateHandle, TArray<TSharedPtr<FComponentRequestHandle>>* OutComponentRequests)
+void FGSCAbilitySystemUtils::TryGrantAbility(UAbilitySystemComponent* InASC, const FGSCGameFeatureAbilityMapping& InAbilityMapping, FGameplayAbilitySpecHandle& OutAbilityHandle, FGameplayAbilitySpec& OutAbilitySpec)
 {
 	check(InASC);
 	
-	UGSCAbilitySystemComponent* ASC = Cast<UGSCAbilitySystemComponent>(InASC);
-	if (!ASC)
+	if (InAbilityMapping.AbilityType.IsNull())
 	{
-		GSC_PLOG(Error, TEXT("Failed to bind Ability \"%s\" because ASC \"%s\" is not a UGSCAbilitySystemComponent"), *InAbilityMapping.AbilityType.ToString(), *GetNameSafe(InASC))
+		GSC_PLOG(Error, TEXT("Failed to Grant Ability \"%s\" because SoftClassPtr is null"), *InAbilityMapping.AbilityType.ToString())
 		return;
 	}
 	
-	AActor* OwnerActor = ASC->GetOwnerActor();
-	AActor* AvatarActor = ASC->GetAvatarActor();
-
-	// UGSCAbilityInputBindingComponent is a PawnComponent, ensure owner of it is actually a pawn
-	APawn* TargetPawn = Cast<APawn>(OwnerActor);
-	if (!TargetPawn)
-	{
-		if (APawn* AvatarPawn = Cast<APawn>(AvatarActor))
-		{
-			TargetPawn = AvatarPawn;
-		}
-	}
+	const TSubclassOf<UGameplayAbility> AbilityType = InAbilityMapping.AbilityType.LoadSynchronous();
+	check(AbilityType);
 
-	if (!TargetPawn)
-	{
-		// May happen for PlayerState characters on BeginPlay of PlayerState, while we really want to wait for OnPossess of the character
-		return;
-	}
+	FGSCResolvedAbilitySet::FAbility Ability;
+	Ability.AbilityType = AbilityType;
+	Ability.Level = InAbilityMapping.Level;
+	GrantResolvedAbility(InASC, Ability, OutAbilityHandle, OutAbilitySpec);
+}
 
-	// AddComponentForActor will only work properly in the context of a Game Feature activating, for all other use case outside of a Game Feature action, it is expected to have the Pawn already
-	// have all required components
-	UGSCAbilityInputBindingComponent* InputComponent = OutComponentRequests != nullptr  ?
-		Cast<UGSCAbilityInputBindingComponent>(FindOrAddComponentForActor(UGSCAbilityInputBindingComponent::StaticClass(), TargetPawn, *OutComponentRequests)) :
-		TargetPawn->FindComponentByClass<UGSCAbilityInputBindingComponent>();
-	
-	if (InputComponent)
-	{
-		GSC_PLOG(Verbose, TEXT("Try to setup input binding for '%s': '%s' (%s)"), *InAbilityMapping.InputAction.ToString(), *InAbilityHandle.ToString(), *InAbilitySpec.Handle.ToString())
-		if (InAbilityHandle.IsValid())
-		{
-			// Setup input binding if AbilityHandle is valid and already granted (on authority, or when Game Features is active by default)
-			InputComponent->SetInputBinding(InAbilityMapping.InputAction.LoadSynchronous(), InAbilityMapping.TriggerEvent, InAbilityHandle);
-		}
-		else
-		{
-			// Register a delegate triggered when ability is granted and available on clients (needed when Game Features are made active during play)
-			OutOnGiveAbilityDelegateHandle = ASC->OnGiveAbilityDelegate.AddStatic(
-				&FGSCAbilitySystemUtils::HandleOnGiveAbility,
-				MakeWeakObjectPtr(InputComponent),
-				MakeWeakObjectPtr(InAbilityMapping.InputAction.LoadSynchronous()),
-				InAbilityMapping.TriggerEvent,
-				InAbilitySpec
-			);
-		}
-	}
-	else
-	{
-		GSC_PLOG(
-			Error,
-			TEXT(
-				"Failed to add an ability input binding component to '%s' -- FindOrAddComponentForActor failed (if added from a GameFeature activating)"
-				"or the Pawn doesn't have a valid UGSCAbilityInputBindingComponent actor component."
-			),
-			*GetNameSafe(TargetPawn)
-		);
-	}
+void FGSCAbilitySystemUtils::TryBindAbilityInput(UAbilitySystemComponent* InASC, const FGSCGameFeatureAbilityMapping& InAbilityMapping, const FGameplayAbilitySpecHandle& InAbilityHandle, const FGameplayAbilitySpec& InAbilitySpec, FDelegateHandle& OutOnGiveAbilityDelegateHandle, TArray<TSharedPtr<FComponentRequestHandle>>* OutComponentRequests)
+{
+	BindResolvedAbilityInput(InASC, InAbilityMapping.InputAction.LoadSynchronous(), InAbilityMapping.TriggerEvent, InAbilityHandle, InAbilitySpec, OutOnGiveAbilityDelegateHandle, OutComponentRequests);
 }
 
 void FGSCAbilitySystemUtils::TryGrantAttributes(UAbilitySystemComponent* InASC, const FGSCGameFeatureAttributeSetMapping& InAttributeSetMapping, UAttributeSet*& OutAttributeSet)
 {
 	check(InASC);
 
-	AActor* OwnerActor = InASC->GetOwnerActor();
-	if (!IsValid(OwnerActor))
-	{
-		GSC_PLOG(Error, TEXT("Ability System Component owner actor is not valid"))
-		return;
-	}
-
-	const TSubclassOf<UAttributeSet> AttributeSetType = InAttributeSetMapping.AttributeSet.LoadSynchronous();
-	if (!AttributeSetType)
+	FGSCResolvedAbilitySet::FAttributeSet AttributeSet;
+	AttributeSet.AttributeSetType = InAttributeSetMapping.AttributeSet.LoadSynchronous();
+	if (!AttributeSet.AttributeSetType)
 	{
 		GSC_PLOG(Error, TEXT("AttributeSet class is invalid"))
 		return;
 	}
 
-	// Prevent adding the same attribute set multiple times (if already registered by another GF or on Actor ASC directly)
-	if (UAttributeSet* AttributeSet = GetAttributeSet(InASC, AttributeSetType))
-	{
-		OutAttributeSet = AttributeSet;
-		// GSC_PLOG(Warning, TEXT("%s AttributeSet is already added to %s"), *AttributeSetType->GetName(), *OwnerActor->GetName())
-		return;
-	}
+	AttributeSet.InitializationData = InAttributeSetMapping.InitializationData.LoadSynchronous();
 
-	OutAttributeSet = NewObject<UAttributeSet>(OwnerActor, AttributeSetType);
-	if (!InAttributeSetMapping.InitializationData.IsNull())
-	{
-		const UDataTable* InitData = InAttributeSetMapping.InitializationData.LoadSynchronous();
-		if (InitData)
-		{
-			OutAttributeSet->InitFromMetaDataTable(InitData);
-		}
-	}
-
-	InASC->AddAttributeSetSubobject(OutAttributeSet);
+	GrantResolvedAttributes(InASC, AttributeSet, OutAttributeSet);
 }
 
 void FGSCAbilitySystemUtils::TryGrantGameplayEffect(UAbilitySystemComponent* InASC, const TSubclassOf<UGameplayEffect> InEffectType, const float InLevel, TArray<FActiveGameplayEffectHandle>& OutEffectHandles)
@@ -206,12 +157,46 @@ void FGSCAbilitySystemUtils::TryGrantGameplayEffect(UAbilitySystemComponent* InA
 bool FGSCAbilitySystemUtils::TryGrantAbilitySet(UAbilitySystemComponent* InASC, const UGSCAbilitySet* InAbilitySet, FGSCAbilitySetHandle& OutAbilitySetHandle, TArray<TSharedPtr<FComponentRequestHandle>>* OutComponentRequests)
 {
 	check(InASC);
-	
-	if (!InAbilitySet)
+
+	FGSCResolvedAbilitySet ResolvedSet;
+	if (!ResolvedSet.Resolve(InAbilitySet))
 	{
 		return false;
 	}
 
+	return TryGrantResolvedAbilitySet(InASC, ResolvedSet, OutAbilitySetHandle, OutComponentRequests);
+}
+
+bool FGSCAbilitySystemUtils::TryGrantAbilitySetToMany(const TArrayView<UAbilitySystemComponent* const> InASCs, const UGSCAbilitySet* InAbilitySet, TArray<FGSCAbilitySetHandle>& OutAbilitySetHandles, TArray<TSharedPtr<FComponentRequestHandle>>* OutComponentRequests)
+{
+	OutAbilitySetHandles.Reset(InASCs.Num());
+	OutAbilitySetHandles.SetNum(InASCs.Num());
+
+	FGSCResolvedAbilitySet ResolvedSet;
+	if (!ResolvedSet.Resolve(InAbilitySet))
+	{
+		return false;
+	}
+
+	for (int32 Index = 0; Index < InASCs.Num(); ++Index)
+	{
+		UAbilitySystemComponent* ASC = InASCs[Index];
+		if (!IsValid(ASC))
+		{
+			GSC_PLOG(Warning, TEXT("Skipping invalid ASC at Index %d while granting ability set %s"), Index, *GetNameSafe(InAbilitySet));
+			continue;
+		}
+
+		TryGrantResolvedAbilitySet(ASC, ResolvedSet, OutAbilitySetHandles[Index], OutComponentRequests);
+	}
+
+	return true;
+}
+
+bool FGSCAbilitySystemUtils::TryGrantResolvedAbilitySet(UAbilitySystemComponent* InASC, const FGSCResolvedAbilitySet& InResolvedSet, FGSCAbilitySetHandle& OutAbilitySetHandle, TArray<TSharedPtr<FComponentRequestHandle>>* OutComponentRequests)
+{
+	check(InASC);
+
 	{
 		using namespace UE::GASCompanion::Log;
 		const FString WorldPrefix = GetWorldLogPrefix(InASC->GetWorld());
@@ -227,46 +212,29 @@ bool FGSCAbilitySystemUtils::TryGrantAbilitySet(UAbilitySystemComponent* InASC,
 	}
 
 	// Add Abilities
-	int32 AbilitiesIndex = 0;
-	for (const FGSCGameFeatureAbilityMapping& AbilityMapping : InAbilitySet->GrantedAbilities)
+	OutAbilitySetHandle.Abilities.Reserve(OutAbilitySetHandle.Abilities.Num() + InResolvedSet.Abilities.Num());
+	for (const FGSCResolvedAbilitySet::FAbility& Ability : InResolvedSet.Abilities)
 	{
-		AbilitiesIndex++;
-		
-		if (AbilityMapping.AbilityType.IsNull())
-		{
-			GSC_PLOG(Error, TEXT("GrantedAbilities AbilityType on ability set %s is not valid at Index %d"), *GetNameSafe(InAbilitySet), AbilitiesIndex  - 1);
-			continue;
-		}
-
 		// Try to grant the ability first
 		FGameplayAbilitySpec AbilitySpec;
 		FGameplayAbilitySpecHandle AbilityHandle;
-		TryGrantAbility(InASC, AbilityMapping, AbilityHandle, AbilitySpec);
+		GrantResolvedAbility(InASC, Ability, AbilityHandle, AbilitySpec);
 		OutAbilitySetHandle.Abilities.Add(AbilityHandle);
 
 		// Handle Input Mapping now
-		if (!AbilityMapping.InputAction.IsNull())
+		if (Ability.InputAction)
 		{
 			FDelegateHandle DelegateHandle;
-			TryBindAbilityInput(InASC, AbilityMapping, AbilityHandle, AbilitySpec, DelegateHandle, OutComponentRequests);
+			BindResolvedAbilityInput(InASC, Ability.InputAction, Ability.TriggerEvent, AbilityHandle, AbilitySpec, DelegateHandle, OutComponentRequests);
 			OutAbilitySetHandle.InputBindingDelegateHandles.Add(MoveTemp(DelegateHandle));
 		}
 	}
 
 	// Add Attributes
-	int32 AttributesIndex = 0;
-	for (const FGSCGameFeatureAttributeSetMapping& Attributes : InAbilitySet->GrantedAttributes)
+	for (const FGSCResolvedAbilitySet::FAttributeSet& AttributeSet : InResolvedSet.Attributes)
 	{
-		AttributesIndex++;
-
-		if (Attributes.AttributeSet.IsNull())
-		{
-			GSC_PLOG(Error, TEXT("GrantedAttributes AttributeSet on ability set %s is not valid at Index %d"), *GetNameSafe(InAbilitySet), AttributesIndex - 1);
-			continue;
-		}
-
 		UAttributeSet* AddedAttributeSet = nullptr;
-		TryGrantAttributes(InASC, Attributes, AddedAttributeSet);
+		GrantResolvedAttributes(InASC, AttributeSet, AddedAttributeSet);
 
 		if (AddedAttributeSet)
 		{
@@ -275,34 +243,33 @@ bool FGSCAbilitySystemUtils::TryGrantAbilitySet(UAbilitySystemComponent* InASC,
 	}
 
 	// Add Effects
-	int32 EffectsIndex = 0;
-	for (const FGSCGameFeatureGameplayEffectMapping& Effect : InAbilitySet->GrantedEffects)
+	for (const FGSCResolvedAbilitySet::FEffect& Effect : InResolvedSet.Effects)
 	{
-		EffectsIndex++;
-		
-		if (Effect.EffectType.IsNull())
-		{
-			GSC_PLOG(Error, TEXT("GrantedEffects EffectType on ability set %s is not valid at Index %d"), *GetNameSafe(InAbilitySet), EffectsIndex - 1);
-			continue;
-		}
-
-		TryGrantGameplayEffect(InASC, Effect.EffectType.LoadSynchronous(), Effect.Level, OutAbilitySetHandle.EffectHandles);
+		TryGrantGameplayEffect(InASC, Effect.EffectType, Effect.Level, OutAbilitySetHandle.EffectHandles);
 	}
 
 	// Add Owned Gameplay Tags
-	if (InAbilitySet->OwnedTags.IsValid())
+	if (InResolvedSet.OwnedTags.IsValid())
 	{		
-		AddLooseGameplayTagsUnique(InASC, InAbilitySet->OwnedTags);
+		AddLooseGameplayTagsUnique(InASC, InResolvedSet.OwnedTags);
 
 		// Store a copy of the tags, so that they can be removed later on from handle
-		OutAbilitySetHandle.OwnedTags = InAbilitySet->OwnedTags;
+		OutAbilitySetHandle.OwnedTags = InResolvedSet.OwnedTags;
 	}
 	
 	// Store the name of the Ability Set "instigator"
-	OutAbilitySetHandle.AbilitySetPathName = InAbilitySet->GetPathName();
+	OutAbilitySetHandle.AbilitySetPathName = InResolvedSet.AbilitySetPathName;
 	return true;
 }
 
+void FGSCAbilitySystemUtils::ResetAttributeSet(UAttributeSet* InAttributeSet, const UDataTable* InInitializationData)
+{
+	check(InAttributeSet);
+
+	FGSCAttributeInitializationCache::Get().ResetAttributeSet(InAttributeSet, InInitializationData);
+	INC_DWORD_STAT(STAT_GSC_AttributeSetsReused);
+}
+
 UAttributeSet* FGSCAbilitySystemUtils::GetAttributeSet(const UAbilitySystemComponent* InASC, const TSubclassOf<UAttributeSet> InAttributeSet)
 {
 	check(InASC);
@@ -336,10 +303,15 @@ bool FGSCAbilitySystemUtils::HasGameplayEffectApplied(const UAbilitySystemCompon
 bool FGSCAbilitySystemUtils::IsAbilityGranted(const UAbilitySystemComponent* InASC, TSubclassOf<UGameplayAbility> InAbility, const int32 InLevel)
 {
 	check(InASC);
+
+	// Companion ASC keeps an index of granted specs per class
+	if (const UGSCAbilitySystemComponent* CompanionASC = Cast<UGSCAbilitySystemComponent>(InASC))
+	{
+		return CompanionASC->FindAbilitySpecHandleFromClassAndLevel(InAbility, InLevel).IsValid();
+	}
 	
 	// Check for activatable abilities, if one is matching the given Ability type, prevent re adding again
-	TArray<FGameplayAbilitySpec> AbilitySpecs = InASC->GetActivatableAbilities();
-	for (const FGameplayAbilitySpec& ActivatableAbility : AbilitySpecs)
+	for (const FGameplayAbilitySpec& ActivatableAbility : InASC->GetActivatableAbilities())
 	{
 		if (!ActivatableAbility.Ability)
 		{
@@ -459,6 +431,162 @@ void FGSCAbilitySystemUtils::RemoveLooseGameplayTagsUnique(UAbilitySystemCompone
 	}
 }
 
+void FGSCAbilitySystemUtils::GrantResolvedAbility(UAbilitySystemComponent* InASC, const FGSCResolvedAbilitySet::FAbility& InAbility, FGameplayAbilitySpecHandle& OutAbilityHandle, FGameplayAbilitySpec& OutAbilitySpec)
+{
+	check(InASC);
+
+	const TSubclassOf<UGameplayAbility> AbilityType = InAbility.AbilityType;
+	check(AbilityType);
+
+	UGSCAbilitySystemComponent* ASC = Cast<UGSCAbilitySystemComponent>(InASC);
+	if (!ASC)
+	{
+		GSC_PLOG(Error, TEXT("Failed to Grant Ability \"%s\" because ASC \"%s\" is not a UGSCAbilitySystemComponent"), *GetNameSafe(AbilityType), *GetNameSafe(InASC))
+		return;
+	}
+
+	OutAbilitySpec = ASC->BuildAbilitySpecFromClass(AbilityType, InAbility.Level);
+	
+	// Try to grant the ability first
+	if (ASC->IsOwnerActorAuthoritative())
+	{
+		// Only Grant abilities on authority, and only if we should (ability not granted yet or wants reset on spawn)
+		if (!IsAbilityGranted(ASC, AbilityType, InAbility.Level))
+		{
+			GSC_PLOG(Verbose, TEXT("Authority, Grant Ability (%s)"), *AbilityType->GetName())
+			OutAbilityHandle = ASC->GiveAbility(OutAbilitySpec);
+		}
+		else
+		{
+			// In case granting is prevented because of ability already existing, return the existing handle
+			const FGameplayAbilitySpec* ExistingAbilitySpec = ASC->FindAbilitySpecFromClass(AbilityType);
+			if (ExistingAbilitySpec)
+			{
+				OutAbilityHandle = ExistingAbilitySpec->Handle;
+			}
+		}
+	}
+	else
+	{
+		// For clients, try to get ability spec and update handle used later on for input binding
+		const FGameplayAbilitySpec* ExistingAbilitySpec = ASC->FindAbilitySpecFromClass(AbilityType);
+		if (ExistingAbilitySpec)
+		{
+			OutAbilityHandle = ExistingAbilitySpec->Handle;
+		}
+		
+		GSC_LOG(Verbose, TEXT("AddActorAbilities: Not Authority, try to find ability handle from spec: %s"), *OutAbilityHandle.ToString())
+	}
+}
+
+void FGSCAbilitySystemUtils::BindResolvedAbilityInput(UAbilitySystemComponent* InASC, UInputAction* InInputAction, const EGSCAbilityTriggerEvent InTriggerEvent, const FGameplayAbilitySpecHandle& InAbilityHandle, const FGameplayAbilitySpec& InAbilitySpec, FDelegateHandle& OutOnGiveAbilityDelegateHandle, TArray<TSharedPtr<FComponentRequestHandle>>* OutComponentRequests)
+{
+	check(InASC);
+	
+	UGSCAbilitySystemComponent* ASC = Cast<UGSCAbilitySystemComponent>(InASC);
+	if (!ASC)
+	{
+		GSC_PLOG(Error, TEXT("Failed to bind Ability \"%s\" because ASC \"%s\" is not a UGSCAbilitySystemComponent"), *GetNameSafe(InAbilitySpec.Ability), *GetNameSafe(InASC))
+		return;
+	}
+
+	AActor* OwnerActor = ASC->GetOwnerActor();
+	AActor* AvatarActor = ASC->GetAvatarActor();
+
+	// UGSCAbilityInputBindingComponent is a PawnComponent, ensure owner of it is actually a pawn
+	APawn* TargetPawn = Cast<APawn>(OwnerActor);
+	if (!TargetPawn)
+	{
+		if (APawn* AvatarPawn = Cast<APawn>(AvatarActor))
+		{
+			TargetPawn = AvatarPawn;
+		}
+	}
+
+	if (!TargetPawn)
+	{
+		// May happen for PlayerState characters on BeginPlay of PlayerState, while we really want to wait for OnPossess of the character
+		return;
+	}
+
+	// AddComponentForActor will only work properly in the context of a Game Feature activating, for all other use case outside of a Game Feature action, it is expected to have the Pawn already
+	// have all required components
+	UGSCAbilityInputBindingComponent* InputComponent = OutComponentRequests != nullptr  ?
+		Cast<UGSCAbilityInputBindingComponent>(FindOrAddComponentForActor(UGSCAbilityInputBindingComponent::StaticClass(), TargetPawn, *OutComponentRequests)) :
+		UGSCBlueprintFunctionLibrary::GetAbilityInputBindingComponent(TargetPawn);
+	
+	if (InputComponent)
+	{
+		GSC_PLOG(Verbose, TEXT("Try to setup input binding for '%s': '%s' (%s)"), *GetNameSafe(InInputAction), *InAbilityHandle.ToString(), *InAbilitySpec.Handle.ToString())
+		if (InAbilityHandle.IsValid())
+		{
+			// Setup input binding if AbilityHandle is valid and already granted (on authority, or when Game Features is active by default)
+			InputComponent->SetInputBinding(InInputAction, InTriggerEvent, InAbilityHandle);
+		}
+		else
+		{
+			// Register a delegate triggered when ability is granted and available on clients (needed when Game Features are made active during play)
+			OutOnGiveAbilityDelegateHandle = ASC->OnGiveAbilityDelegate.AddStatic(
+				&FGSCAbilitySystemUtils::HandleOnGiveAbility,
+				MakeWeakObjectPtr(InputComponent),
+				MakeWeakObjectPtr(InInputAction),
+				InTriggerEvent,
+				InAbilitySpec
+			);
+		}
+	}
+	else
+	{
+		GSC_PLOG(
+			Error,
+			TEXT(
+				"Failed to add an ability input binding component to '%s' -- FindOrAddComponentForActor failed (if added from a GameFeature activating)"
+				"or the Pawn doesn't have a valid UGSCAbilityInputBindingComponent actor component."
+			),
+			*GetNameSafe(TargetPawn)
+		);
+	}
+}
+
+void FGSCAbilitySystemUtils::GrantResolvedAttributes(UAbilitySystemComponent* InASC, const FGSCResolvedAbilitySet::FAttributeSet& InAttributeSet, UAttributeSet*& OutAttributeSet)
+{
+	check(InASC);
+
+	AActor* OwnerActor = InASC->GetOwnerActor();
+	if (!IsValid(OwnerActor))
+	{
+		GSC_PLOG(Error, TEXT("Ability System Component owner actor is not valid"))
+		return;
+	}
+
+	const TSubclassOf<UAttributeSet> AttributeSetType = InAttributeSet.AttributeSetType;
+	check(AttributeSetType);
+
+	// Prevent adding the same attribute set multiple times (if already registered by another GF or on Actor ASC directly)
+	if (UAttributeSet* AttributeSet = GetAttributeSet(InASC, AttributeSetType))
+	{
+		OutAttributeSet = AttributeSet;
+		// GSC_PLOG(Warning, TEXT("%s AttributeSet is already added to %s"), *AttributeSetType->GetName(), *OwnerActor->GetName())
+		return;
+	}
+
+	OutAttributeSet = NewObject<UAttributeSet>(OwnerActor, AttributeSetType);
+	INC_DWORD_STAT(STAT_GSC_AttributeSetsAllocated);
+
+	if (InAttributeSet.InitializationData)
+	{
+		FGSCAttributeInitializationCache::Get().InitAttributeSet(OutAttributeSet, InAttributeSet.InitializationData);
+	}
+
+	InASC->AddAttributeSetSubobject(OutAttributeSet);
+
+	// Make sure attributes of the newly added set are forwarded to listeners of the ASC attribute change dispatcher
+	if (UGSCAbilitySystemComponent* ASC = Cast<UGSCAbilitySystemComponent>(InASC))
+	{
+		ASC->RegisterAttributeChangeDispatcher();
+	}
+}
+
 // ReSharper disable once CppParameterMayBeConstPtrOrRef
 // ReSharper disable once CppPassValueParameterByConstReference
 void FGSCAbilitySystemUtils::HandleOnGiveAbility(FGameplayAbilitySpec& InAbilitySpec, TWeakObjectPtr<UGSCAbilityInputBindingComponent> InInputComponent, TWeakObjectPtr<UInputAction> InInputAction, const EGSCAbilityTriggerEvent InTriggerEvent, FGameplayAbilitySpec InNewAbilitySpec)
@@ -10,6 +10,7 @@
 #include "Components/GSCAbilityQueueComponent.h"
 #include "Components/GSCComboManagerComponent.h"
 #include "Components/GSCCoreComponent.h"
+#include "Subsystems/GSCComponentRegistrySubsystem.h"
 
 UGSCAbilitySystemComponent* UGSCBlueprintFunctionLibrary::GetCompanionAbilitySystemComponent(const AActor* Actor)
 {
@@ -35,8 +36,7 @@ UGSCComboManagerComponent* UGSCBlueprintFunctionLibrary::GetComboManagerComponen
 		return nullptr;
 	}
 
-	// Fall back to a component search to better support BP-only actors
-	return Actor->FindComponentByClass<UGSCComboManagerComponent>();
+	return UGSCComponentRegistrySubsystem::FindComponentForActor<UGSCComboManagerComponent>(Actor);
 }
 
 UGSCCoreComponent* UGSCBlueprintFunctionLibrary::GetCompanionCoreComponent(const AActor* Actor)
@@ -46,8 +46,7 @@ UGSCCoreComponent* UGSCBlueprintFunctionLibrary::GetCompanionCoreComponent(const
 		return nullptr;
 	}
 
-	// Fall back to a component search to better support BP-only actors
-	return Actor->FindComponentByClass<UGSCCoreComponent>();
+	return UGSCComponentRegistrySubsystem::FindComponentForActor<UGSCCoreComponent>(Actor);
 }
 
 UGSCAbilityQueueComponent* UGSCBlueprintFunctionLibrary::GetAbilityQueueComponent(const AActor* Actor)
@@ -57,7 +56,7 @@ UGSCAbilityQueueComponent* UGSCBlueprintFunctionLibrary::GetAbilityQueueComponen
 		return nullptr;
 	}
 
-	return Actor->FindComponentByClass<UGSCAbilityQueueComponent>();
+	return UGSCComponentRegistrySubsystem::FindComponentForActor<UGSCAbilityQueueComponent>(Actor);
 }
 
 UGSCAbilityInputBindingComponent* UGSCBlueprintFunctionLibrary::GetAbilityInputBindingComponent(const AActor* Actor)
@@ -67,8 +66,7 @@ UGSCAbilityInputBindingComponent* UGSCBlueprintFunctionLibrary::GetAbilityInputB
 		return nullptr;
 	}
 
-	// Fall back to a component search to better support BP-only actors
-	return Actor->FindComponentByClass<UGSCAbilityInputBindingComponent>();
+	return UGSCComponentRegistrySubsystem::FindComponentForActor<UGSCAbilityInputBindingComponent>(Actor);
 }
 
 bool UGSCBlueprintFunctionLibrary::AddLooseGameplayTagsToActor(AActor* Actor, const FGameplayTagContainer GameplayTags)
@@ -0,0 +1,265 @@
+// Copyright 2021 Mickael Daniel. All Rights Reserved.
+
+#include "Abilities/GSCCooldownTracker.h"
+
+#include "AbilitySystemComponent.h"
+#include "GSCLog.h"
+#include "Abilities/GameplayAbility.h"
+#include "Engine/World.h"
+#include "TimerManager.h"
+
+namespace GSCCooldownTracker
+{
+	/** Delay before checking again a cooldown whose tags are still there once expired (effect about to be removed) */
+	static constexpr float MinRequeueDelay = 0.05f;
+}
+
+void FGSCCooldownTracker::Initialize(UAbilitySystemComponent* InASC)
+{
+	check(InASC);
+
+	Deinitialize();
+
+	ASC = InASC;
+	InASC->AbilityCommittedCallbacks.AddRaw(this, &FGSCCooldownTracker::OnAbilityCommitted);
+	InASC->OnAnyGameplayEffectRemovedDelegate().AddRaw(this, &FGSCCooldownTracker::OnGameplayEffectRemoved);
+}
+
+void FGSCCooldownTracker::Deinitialize()
+{
+	if (UAbilitySystemComponent* AbilitySystemComponent = ASC.Get())
+	{
+		AbilitySystemComponent->AbilityCommittedCallbacks.RemoveAll(this);
+		AbilitySystemComponent->OnAnyGameplayEffectRemovedDelegate().RemoveAll(this);
+
+		if (const UWorld* World = AbilitySystemComponent->GetWorld())
+		{
+			World->GetTimerManager().ClearTimer(TimerHandle);
+		}
+	}
+
+	ASC.Reset();
+	Cooldowns.Reset();
+	Expirations.Reset();
+	TimerHandle.Invalidate();
+	TimerExpirationTime = 0.0;
+}
+
+bool FGSCCooldownTracker::GetCooldownRemaining(const FGameplayAbilitySpecHandle& InSpecHandle, float& OutTimeRemaining, float& OutDuration) const
+{
+	OutTimeRemaining = 0.f;
+	OutDuration = 0.f;
+
+	const FCooldown* Cooldown = Cooldowns.Find(InSpecHandle);
+	if (!Cooldown)
+	{
+		return false;
+	}
+
+	// Untimed cooldown (infinite effect), same convention as GAS effect queries
+	OutTimeRemaining = Cooldown->Duration < 0.f ? -1.f : FMath::Max(static_cast<float>(Cooldown->ExpirationTime - GetTime()), 0.f);
+	OutDuration = Cooldown->Duration;
+	return true;
+}
+
+bool FGSCCooldownTracker::GetCooldownRemainingForClass(const UClass* InAbilityClass, float& OutTimeRemaining, float& OutDuration) const
+{
+	if (!InAbilityClass)
+	{
+		return false;
+	}
+
+	for (const TPair<FGameplayAbilitySpecHandle, FCooldown>& Pair : Cooldowns)
+	{
+		const UClass* AbilityClass = Pair.Value.AbilityClass.Get();
+		if (AbilityClass && AbilityClass->IsChildOf(InAbilityClass))
+		{
+			return GetCooldownRemaining(Pair.Key, OutTimeRemaining, OutDuration);
+		}
+	}
+
+	OutTimeRemaining = 0.f;
+	OutDuration = 0.f;
+	return false;
+}
+
+double FGSCCooldownTracker::GetTime() const
+{
+	const UAbilitySystemComponent* AbilitySystemComponent = ASC.Get();
+	const UWorld* World = AbilitySystemComponent ? AbilitySystemComponent->GetWorld() : nullptr;
+	return World ? World->GetTimeSeconds() : 0.0;
+}
+
+void FGSCCooldownTracker::OnAbilityCommitted(UGameplayAbility* InAbility)
+{
+	if (!IsValid(InAbility))
+	{
+		GSC_LOG(Warning, TEXT("FGSCCooldownTracker::OnAbilityCommitted() Activated ability not valid"))
+		return;
+	}
+
+	if (!InAbility->GetCooldownGameplayEffect() || !InAbility->IsInstantiated())
+	{
+		return;
+	}
+
+	const FGameplayTagContainer* CooldownTags = InAbility->GetCooldownTags();
+	if (!CooldownTags || CooldownTags->Num() <= 0)
+	{
+		return;
+	}
+
+	const FGameplayAbilityActorInfo ActorInfo = InAbility->GetActorInfo();
+	const FGameplayAbilitySpecHandle SpecHandle = InAbility->GetCurrentAbilitySpecHandle();
+
+	float TimeRemaining = 0.f;
+	float Duration = 0.f;
+	InAbility->GetCooldownTimeRemainingAndDuration(SpecHandle, &ActorInfo, TimeRemaining, Duration);
+
+	OnCooldownStart.Broadcast(InAbility, *CooldownTags, TimeRemaining, Duration);
+
+	if (TimeRemaining == 0.f && Duration == 0.f)
+	{
+		// Cooldown effect wasn't applied
+		return;
+	}
+
+	// Replaces any cooldown previously tracked for this spec, its heap entry becomes stale
+	FCooldown& Cooldown = Cooldowns.Add(SpecHandle);
+	Cooldown.AbilityClass = InAbility->GetClass();
+	Cooldown.CooldownTags = *CooldownTags;
+	Cooldown.Duration = Duration;
+
+	if (TimeRemaining > 0.f)
+	{
+		Cooldown.ExpirationTime = GetTime() + TimeRemaining;
+		Expirations.HeapPush({ SpecHandle, Cooldown.ExpirationTime });
+		ScheduleTimer();
+	}
+}
+
+void FGSCCooldownTracker::OnGameplayEffectRemoved(const FActiveGameplayEffect& InEffectRemoved)
+{
+	const UAbilitySystemComponent* AbilitySystemComponent = ASC.Get();
+	if (Cooldowns.IsEmpty() || !AbilitySystemComponent)
+	{
+		return;
+	}
+
+	// Cooldown effect removed before its expiration (or untimed cooldown)
+	TArray<FGameplayAbilitySpecHandle, TInlineAllocator<4>> EndedCooldowns;
+	for (const TPair<FGameplayAbilitySpecHandle, FCooldown>& Pair : Cooldowns)
+	{
+		if (!AbilitySystemComponent->HasAnyMatchingGameplayTags(Pair.Value.CooldownTags))
+		{
+			EndedCooldowns.Add(Pair.Key);
+		}
+	}
+
+	for (const FGameplayAbilitySpecHandle& SpecHandle : EndedCooldowns)
+	{
+		FCooldown Cooldown;
+		if (Cooldowns.RemoveAndCopyValue(SpecHandle, Cooldown))
+		{
+			EndCooldown(SpecHandle, Cooldown);
+		}
+	}
+}
+
+void FGSCCooldownTracker::ProcessExpirations()
+{
+	// Called from the timer, which is still active (executing) until this returns. Forget about it so that ScheduleTimer sets a new one.
+	TimerHandle.Invalidate();
+	TimerExpirationTime = 0.0;
+
+	UAbilitySystemComponent* AbilitySystemComponent = ASC.Get();
+	if (!AbilitySystemComponent)
+	{
+		return;
+	}
+
+	const double Now = GetTime();
+	while (!Expirations.IsEmpty() && Expirations.HeapTop().ExpirationTime <= Now)
+	{
+		FExpiration Expiration;
+		Expirations.HeapPop(Expiration, false);
+
+		FCooldown* Cooldown = Cooldowns.Find(Expiration.SpecHandle);
+		if (!Cooldown || Cooldown->ExpirationTime != Expiration.ExpirationTime)
+		{
+			// Stale entry, cooldown restarted or ended early
+			continue;
+		}
+
+		if (AbilitySystemComponent->HasAnyMatchingGameplayTags(Cooldown->CooldownTags))
+		{
+			// Cooldown was extended, or the effect is about to be removed. Check again later on.
+			float TimeRemaining = 0.f;
+			const FGameplayEffectQuery Query = FGameplayEffectQuery::MakeQuery_MatchAnyOwningTags(Cooldown->CooldownTags);
+			for (const TPair<float, float>& RemainingAndDuration : AbilitySystemComponent->GetActiveEffectsTimeRemainingAndDuration(Query))
+			{
+				TimeRemaining = FMath::Max(TimeRemaining, RemainingAndDuration.Key);
+			}
+
+			Cooldown->ExpirationTime = Now + FMath::Max(TimeRemaining, GSCCooldownTracker::MinRequeueDelay);
+			Expirations.HeapPush({ Expiration.SpecHandle, Cooldown->ExpirationTime });
+			continue;
+		}
+
+		const FCooldown EndedCooldown = MoveTemp(*Cooldown);
+		Cooldowns.Remove(Expiration.SpecHandle);
+		EndCooldown(Expiration.SpecHandle, EndedCooldown);
+	}
+
+	ScheduleTimer();
+}
+
+void FGSCCooldownTracker::EndCooldown(const FGameplayAbilitySpecHandle& InSpecHandle, const FCooldown& InCooldown) const
+{
+	UAbilitySystemComponent* AbilitySystemComponent = ASC.Get();
+	const FGameplayAbilitySpec* AbilitySpec = AbilitySystemComponent ? AbilitySystemComponent->FindAbilitySpecFromHandle(InSpecHandle) : nullptr;
+
+	// Ability might have been cleared when cooldown expires
+	if (!AbilitySpec || !IsValid(AbilitySpec->Ability))
+	{
+		return;
+	}
+
+	for (const FGameplayTag& CooldownTag : InCooldown.CooldownTags)
+	{
+		OnCooldownEnd.Broadcast(AbilitySpec->Ability, CooldownTag, InCooldown.Duration);
+	}
+}
+
+void FGSCCooldownTracker::ScheduleTimer()
+{
+	UAbilitySystemComponent* AbilitySystemComponent = ASC.Get();
+	UWorld* World = AbilitySystemComponent ? AbilitySystemComponent->GetWorld() : nullptr;
+	if (!World)
+	{
+		return;
+	}
+
+	FTimerManager& TimerManager = World->GetTimerManager();
+	if (Expirations.IsEmpty())
+	{
+		TimerManager.ClearTimer(TimerHandle);
+		TimerExpirationTime = 0.0;
+		return;
+	}
+
+	// Timer already set to fire before the next expiration
+	const double NextExpirationTime = Expirations.HeapTop().ExpirationTime;
+	if (TimerManager.IsTimerActive(TimerHandle) && TimerExpirationTime <= NextExpirationTime)
+	{
+		return;
+	}
+
+	const float Delay = FMath::Max(static_cast<float>(NextExpirationTime - GetTime()), UE_KINDA_SMALL_NUMBER);
+	TimerManager.SetTimer(TimerHandle, FTimerDelegate::CreateWeakLambda(AbilitySystemComponent, [this]()
+	{
+		ProcessExpirations();
+	}), Delay, false);
+
+	TimerExpirationTime = NextExpirationTime;
+}
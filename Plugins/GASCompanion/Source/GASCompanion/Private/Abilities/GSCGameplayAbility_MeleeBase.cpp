@@ -3,6 +3,7 @@
 
 #include "Abilities/GSCGameplayAbility_MeleeBase.h"
 
+#include "AbilitySystemComponent.h"
 #include "Abilities/GSCBlueprintFunctionLibrary.h"
 #include "Abilities/Tasks/GSCTask_PlayMontageWaitForEvent.h"
 #include "Components/GSCComboManagerComponent.h"
@@ -33,7 +34,7 @@ void UGSCGameplayAbility_MeleeBase::ActivateAbility(const FGameplayAbilitySpecHa
 		return;
 	}
 
-	ComboManagerComponent->IncrementCombo();
+	ComboManagerComponent->OnComboAbilityActivated(ActivationInfo);
 
 	UAnimMontage* Montage = GetNextComboMontage();
 
@@ -46,6 +47,25 @@ void UGSCGameplayAbility_MeleeBase::ActivateAbility(const FGameplayAbilitySpecHa
 	Task->ReadyForActivation();
 }
 
+bool UGSCGameplayAbility_MeleeBase::CanActivateAbility(const FGameplayAbilitySpecHandle Handle, const FGameplayAbilityActorInfo* ActorInfo, const FGameplayTagContainer* SourceTags, const FGameplayTagContainer* TargetTags, FGameplayTagContainer* OptionalRelevantTags) const
+{
+	if (!Super::CanActivateAbility(Handle, ActorInfo, SourceTags, TargetTags, OptionalRelevantTags))
+	{
+		return false;
+	}
+
+	const UAbilitySystemComponent* ASC = ActorInfo ? ActorInfo->AbilitySystemComponent.Get() : nullptr;
+	const FGameplayAbilitySpec* Spec = ASC ? ASC->FindAbilitySpecFromHandle(Handle) : nullptr;
+	if (!Spec || !Spec->IsActive())
+	{
+		return true;
+	}
+
+	// Next combo is only allowed within the combo window, which is how server rejects next combo predicted by clients outside of it
+	const UGSCComboManagerComponent* ComboComponent = UGSCBlueprintFunctionLibrary::GetComboManagerComponent(ActorInfo->AvatarActor.Get());
+	return !ComboComponent || ComboComponent->CanActivateNextCombo();
+}
+
 void UGSCGameplayAbility_MeleeBase::OnMontageCancelled(FGameplayTag EventTag, FGameplayEventData EventData)
 {
 	EndAbility(CurrentSpecHandle, CurrentActorInfo, CurrentActivationInfo, true, true);
@@ -0,0 +1,45 @@
+// Copyright 2021 Mickael Daniel. All Rights Reserved.
+
+#include "Abilities/GSCInputIDAllocator.h"
+
+int32 FGSCInputIDAllocator::Allocate()
+{
+	if (FreeInputIDs.Num() > 0)
+	{
+		int32 InputID;
+		FreeInputIDs.HeapPop(InputID, false);
+		return InputID;
+	}
+
+	return NextInputID++;
+}
+
+void FGSCInputIDAllocator::Release(const int32 InInputID)
+{
+	if (InInputID <= 0 || InInputID >= NextInputID || FreeInputIDs.Contains(InInputID))
+	{
+		return;
+	}
+
+	// Shrink back when releasing the highest InputID, keeps the free list small
+	if (InInputID == NextInputID - 1)
+	{
+		--NextInputID;
+		while (FreeInputIDs.Num() > 0 && FreeInputIDs.Contains(NextInputID - 1))
+		{
+			FreeInputIDs.Remove(NextInputID - 1);
+			--NextInputID;
+		}
+
+		FreeInputIDs.Heapify();
+		return;
+	}
+
+	FreeInputIDs.HeapPush(InInputID);
+}
+
+void FGSCInputIDAllocator::Reset()
+{
+	NextInputID = 1;
+	FreeInputIDs.Reset();
+}
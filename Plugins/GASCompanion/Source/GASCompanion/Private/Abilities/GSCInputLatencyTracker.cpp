@@ -0,0 +1,381 @@
+// Copyright 2021 Mickael Daniel. All Rights Reserved.
+
+#include "Abilities/GSCInputLatencyTracker.h"
+
+#include "AbilitySystemComponent.h"
+#include "GSCLog.h"
+#include "Abilities/GameplayAbility.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/DateTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "ProfilingDebugging/CsvProfiler.h"
+
+CSV_DEFINE_CATEGORY(GASCompanion, true);
+
+namespace GSCInputLatencyTracker
+{
+	static bool bEnabled = false;
+	static float MaxPendingTime = 2.f;
+
+	static FAutoConsoleVariableRef CVarEnabled(
+		TEXT("GASCompanion.InputLatency.Enabled"),
+		bEnabled,
+		TEXT("Enables measurement of ability input latency, from input action trigger to ability activation.")
+	);
+
+	static FAutoConsoleVariableRef CVarMaxPendingTime(
+		TEXT("GASCompanion.InputLatency.MaxPendingTime"),
+		MaxPendingTime,
+		TEXT("Time in seconds after which an ability input that did not activate any ability is no longer tracked.")
+	);
+
+	static FAutoConsoleCommandWithWorldArgsAndOutputDevice DumpCommand(
+		TEXT("GASCompanion.InputLatency.Dump"),
+		TEXT("Prints ability input latency histograms per ability class. Pass \"csv\" to also write them to the profiling directory."),
+		FConsoleCommandWithWorldArgsAndOutputDeviceDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* InWorld, FOutputDevice& Ar)
+		{
+			const FGSCInputLatencyTracker& Tracker = FGSCInputLatencyTracker::Get();
+			Tracker.Dump(Ar);
+
+			if (Args.Contains(TEXT("csv")))
+			{
+				const FString Filename = FPaths::Combine(FPaths::ProfilingDir(), TEXT("GASCompanion"), FString::Printf(TEXT("InputLatency-%s.csv"), *FDateTime::Now().ToString()));
+				if (Tracker.WriteCSV(Filename))
+				{
+					Ar.Logf(TEXT("Input latency written to %s"), *FPaths::ConvertRelativePathToFull(Filename));
+				}
+				else
+				{
+					Ar.Logf(TEXT("Failed to write input latency to %s"), *Filename);
+				}
+			}
+		})
+	);
+
+	static FAutoConsoleCommand ResetCommand(
+		TEXT("GASCompanion.InputLatency.Reset"),
+		TEXT("Clears out recorded ability input latency histograms."),
+		FConsoleCommandDelegate::CreateLambda([]()
+		{
+			FGSCInputLatencyTracker::Get().Reset();
+		})
+	);
+
+	static double ToMilliseconds(const double InStartTime, const double InEndTime)
+	{
+		return (InEndTime - InStartTime) * 1000.0;
+	}
+}
+
+const TCHAR* LexToString(const EGSCInputLatencyStage InStage)
+{
+	switch (InStage)
+	{
+	case EGSCInputLatencyStage::AbilityInput: return TEXT("AbilityInput");
+	case EGSCInputLatencyStage::ComboGating: return TEXT("ComboGating");
+	case EGSCInputLatencyStage::QueueGating: return TEXT("QueueGating");
+	case EGSCInputLatencyStage::ActivationRequested: return TEXT("ActivationRequested");
+	case EGSCInputLatencyStage::Activated: return TEXT("Activated");
+	case EGSCInputLatencyStage::ServerConfirmed: return TEXT("ServerConfirmed");
+	default: return TEXT("Unknown");
+	}
+}
+
+FGSCInputLatencyHistogram::FGSCInputLatencyHistogram()
+{
+	for (uint32& Bucket : Buckets)
+	{
+		Bucket = 0;
+	}
+}
+
+void FGSCInputLatencyHistogram::AddSample(const double InLatencyMs)
+{
+	const double LatencyMs = FMath::Max(InLatencyMs, 0.0);
+	const int32 BucketIndex = LatencyMs < 1.0 ? 0 : FMath::Min(static_cast<int32>(FMath::FloorLog2(static_cast<uint32>(LatencyMs))) + 1, NumBuckets - 1);
+	++Buckets[BucketIndex];
+
+	MinMs = Count == 0 ? LatencyMs : FMath::Min(MinMs, LatencyMs);
+	MaxMs = Count == 0 ? LatencyMs : FMath::Max(MaxMs, LatencyMs);
+	SumMs += LatencyMs;
+	++Count;
+}
+
+double FGSCInputLatencyHistogram::GetPercentileMs(const double InPercentile) const
+{
+	if (Count == 0)
+	{
+		return 0.0;
+	}
+
+	const uint32 Threshold = FMath::Max(static_cast<uint32>(FMath::CeilToDouble(FMath::Clamp(InPercentile, 0.0, 1.0) * Count)), 1u);
+	uint32 Accumulated = 0;
+	for (int32 BucketIndex = 0; BucketIndex < NumBuckets; ++BucketIndex)
+	{
+		Accumulated += Buckets[BucketIndex];
+		if (Accumulated >= Threshold)
+		{
+			return FMath::Min(GetBucketUpperBoundMs(BucketIndex), MaxMs);
+		}
+	}
+
+	return MaxMs;
+}
+
+double FGSCInputLatencyHistogram::GetBucketUpperBoundMs(const int32 InBucketIndex)
+{
+	return InBucketIndex >= NumBuckets - 1 ? TNumericLimits<double>::Max() : static_cast<double>(1 << InBucketIndex);
+}
+
+bool FGSCInputLatencyTracker::IsEnabled()
+{
+	return GSCInputLatencyTracker::bEnabled;
+}
+
+FGSCInputLatencyTracker& FGSCInputLatencyTracker::Get()
+{
+	static FGSCInputLatencyTracker Instance;
+	return Instance;
+}
+
+void FGSCInputLatencyTracker::SetEnabled(const bool bInEnabled)
+{
+	GSCInputLatencyTracker::bEnabled = bInEnabled;
+	if (!bInEnabled)
+	{
+		Get().PendingInputs.Reset();
+	}
+}
+
+void FGSCInputLatencyTracker::BeginInput(const UAbilitySystemComponent* InASC, const int32 InInputID)
+{
+	if (!IsEnabled() || !InASC)
+	{
+		return;
+	}
+
+	const double Now = FPlatformTime::Seconds();
+	PrunePendingInputs(Now);
+
+	FPendingInput& PendingInput = PendingInputs.Add(InASC);
+	PendingInput.InputID = InInputID;
+	PendingInput.StartTime = Now;
+	for (double& StageLatency : PendingInput.StageLatencies)
+	{
+		StageLatency = -1.0;
+	}
+}
+
+void FGSCInputLatencyTracker::MarkStage(const UAbilitySystemComponent* InASC, const EGSCInputLatencyStage InStage)
+{
+	if (!IsEnabled() || !InASC)
+	{
+		return;
+	}
+
+	FPendingInput* PendingInput = PendingInputs.Find(InASC);
+	if (!PendingInput)
+	{
+		return;
+	}
+
+	// Keep the first time a stage is reached, several specs may share the same InputID
+	double& StageLatency = PendingInput->StageLatencies[static_cast<int32>(InStage)];
+	if (StageLatency < 0.0)
+	{
+		StageLatency = GSCInputLatencyTracker::ToMilliseconds(PendingInput->StartTime, FPlatformTime::Seconds());
+	}
+}
+
+void FGSCInputLatencyTracker::OnAbilityActivated(const UAbilitySystemComponent* InASC, const UGameplayAbility* InAbility)
+{
+	if (!IsEnabled() || !InASC || !InAbility)
+	{
+		return;
+	}
+
+	const FPendingInput* PendingInputPtr = PendingInputs.Find(InASC);
+	if (!PendingInputPtr)
+	{
+		// Not activated from an ability input
+		return;
+	}
+
+	const double Now = FPlatformTime::Seconds();
+	if (Now - PendingInputPtr->StartTime > GSCInputLatencyTracker::MaxPendingTime)
+	{
+		PendingInputs.Remove(InASC);
+		return;
+	}
+
+	// Non instanced abilities are activated as their CDO, without a current spec handle
+	const FGameplayAbilitySpecHandle SpecHandle = InAbility->GetCurrentAbilitySpecHandle();
+	const FGameplayAbilitySpec* Spec = SpecHandle.IsValid() ? InASC->FindAbilitySpecFromHandle(SpecHandle) : InASC->FindAbilitySpecFromClass(InAbility->GetClass());
+	if (!Spec || Spec->InputID != PendingInputPtr->InputID)
+	{
+		// Activated by other means while the input is pending, keep it for the ability bound to it
+		return;
+	}
+
+	FPendingInput PendingInput;
+	PendingInputs.RemoveAndCopyValue(InASC, PendingInput);
+
+	PendingInput.StageLatencies[static_cast<int32>(EGSCInputLatencyStage::Activated)] = GSCInputLatencyTracker::ToMilliseconds(PendingInput.StartTime, Now);
+
+	const FName AbilityClassName = InAbility->GetClass()->GetFName();
+	for (int32 StageIndex = 0; StageIndex < PendingInput.StageLatencies.Num(); ++StageIndex)
+	{
+		if (PendingInput.StageLatencies[StageIndex] >= 0.0)
+		{
+			RecordLatency(AbilityClassName, static_cast<EGSCInputLatencyStage>(StageIndex), PendingInput.StageLatencies[StageIndex]);
+		}
+	}
+
+	CSV_CUSTOM_STAT(GASCompanion, InputLatencyActivatedMs, static_cast<float>(PendingInput.StageLatencies[static_cast<int32>(EGSCInputLatencyStage::Activated)]), ECsvCustomStatOp::Max);
+
+	// Predicted activation, wait for the server to catch up with the activation prediction key
+	FPredictionKey PredictionKey = InAbility->GetCurrentActivationInfo().GetActivationPredictionKey();
+	if (!InASC->IsOwnerActorAuthoritative() && PredictionKey.IsValidKey() && PredictionKey.IsLocalClientKey())
+	{
+		const double StartTime = PendingInput.StartTime;
+		PredictionKey.NewCaughtUpDelegate().BindLambda([AbilityClassName, StartTime]()
+		{
+			if (!IsEnabled())
+			{
+				return;
+			}
+
+			const double LatencyMs = GSCInputLatencyTracker::ToMilliseconds(StartTime, FPlatformTime::Seconds());
+			Get().RecordLatency(AbilityClassName, EGSCInputLatencyStage::ServerConfirmed, LatencyMs);
+			CSV_CUSTOM_STAT(GASCompanion, InputLatencyServerConfirmedMs, static_cast<float>(LatencyMs), ECsvCustomStatOp::Max);
+		});
+	}
+}
+
+void FGSCInputLatencyTracker::RecordLatency(const FName InAbilityClassName, const EGSCInputLatencyStage InStage, const double InLatencyMs)
+{
+	if (InStage == EGSCInputLatencyStage::Num)
+	{
+		return;
+	}
+
+	GSC_LOG(VeryVerbose, TEXT("FGSCInputLatencyTracker::RecordLatency %s %s: %.3f ms"), *InAbilityClassName.ToString(), LexToString(InStage), InLatencyMs)
+	Histograms.FindOrAdd(InAbilityClassName)[static_cast<int32>(InStage)].AddSample(InLatencyMs);
+}
+
+const FGSCInputLatencyHistogram* FGSCInputLatencyTracker::FindHistogram(const FName InAbilityClassName, const EGSCInputLatencyStage InStage) const
+{
+	const FStageHistograms* StageHistograms = InStage != EGSCInputLatencyStage::Num ? Histograms.Find(InAbilityClassName) : nullptr;
+	if (!StageHistograms)
+	{
+		return nullptr;
+	}
+
+	const FGSCInputLatencyHistogram& Histogram = (*StageHistograms)[static_cast<int32>(InStage)];
+	return Histogram.Count > 0 ? &Histogram : nullptr;
+}
+
+void FGSCInputLatencyTracker::Reset()
+{
+	PendingInputs.Reset();
+	Histograms.Reset();
+}
+
+void FGSCInputLatencyTracker::Dump(FOutputDevice& Ar) const
+{
+	if (!IsEnabled())
+	{
+		Ar.Logf(TEXT("Input latency tracking is disabled, enable it with GASCompanion.InputLatency.Enabled 1"));
+	}
+
+	if (Histograms.IsEmpty())
+	{
+		Ar.Logf(TEXT("No input latency recorded"));
+		return;
+	}
+
+	for (const TPair<FName, FStageHistograms>& Pair : Histograms)
+	{
+		Ar.Logf(TEXT("%s"), *Pair.Key.ToString());
+
+		for (int32 StageIndex = 0; StageIndex < Pair.Value.Num(); ++StageIndex)
+		{
+			const FGSCInputLatencyHistogram& Histogram = Pair.Value[StageIndex];
+			if (Histogram.Count == 0)
+			{
+				continue;
+			}
+
+			Ar.Logf(
+				TEXT("  %-20s count: %5u  min: %8.3f ms  mean: %8.3f ms  p50: <= %8.3f ms  p95: <= %8.3f ms  max: %8.3f ms"),
+				LexToString(static_cast<EGSCInputLatencyStage>(StageIndex)),
+				Histogram.Count,
+				Histogram.MinMs,
+				Histogram.GetMeanMs(),
+				Histogram.GetPercentileMs(0.5),
+				Histogram.GetPercentileMs(0.95),
+				Histogram.MaxMs
+			);
+		}
+	}
+}
+
+FString FGSCInputLatencyTracker::ToCSV() const
+{
+	FString Result = TEXT("AbilityClass,Stage,Count,MinMs,MeanMs,MaxMs");
+	for (int32 BucketIndex = 0; BucketIndex < FGSCInputLatencyHistogram::NumBuckets; ++BucketIndex)
+	{
+		Result += BucketIndex < FGSCInputLatencyHistogram::NumBuckets - 1
+			? FString::Printf(TEXT(",Below%dMs"), static_cast<int32>(FGSCInputLatencyHistogram::GetBucketUpperBoundMs(BucketIndex)))
+			: FString::Printf(TEXT(",Above%dMs"), static_cast<int32>(FGSCInputLatencyHistogram::GetBucketUpperBoundMs(BucketIndex - 1)));
+	}
+	Result += LINE_TERMINATOR;
+
+	for (const TPair<FName, FStageHistograms>& Pair : Histograms)
+	{
+		for (int32 StageIndex = 0; StageIndex < Pair.Value.Num(); ++StageIndex)
+		{
+			const FGSCInputLatencyHistogram& Histogram = Pair.Value[StageIndex];
+			if (Histogram.Count == 0)
+			{
+				continue;
+			}
+
+			Result += FString::Printf(
+				TEXT("%s,%s,%u,%.3f,%.3f,%.3f"),
+				*Pair.Key.ToString(),
+				LexToString(static_cast<EGSCInputLatencyStage>(StageIndex)),
+				Histogram.Count,
+				Histogram.MinMs,
+				Histogram.GetMeanMs(),
+				Histogram.MaxMs
+			);
+
+			for (const uint32 Bucket : Histogram.Buckets)
+			{
+				Result += FString::Printf(TEXT(",%u"), Bucket);
+			}
+			Result += LINE_TERMINATOR;
+		}
+	}
+
+	return Result;
+}
+
+bool FGSCInputLatencyTracker::WriteCSV(const FString& InFilename) const
+{
+	return FFileHelper::SaveStringToFile(ToCSV(), *InFilename);
+}
+
+void FGSCInputLatencyTracker::PrunePendingInputs(const double InNow)
+{
+	for (auto It = PendingInputs.CreateIterator(); It; ++It)
+	{
+		if (InNow - It.Value().StartTime > GSCInputLatencyTracker::MaxPendingTime || !It.Key().ResolveObjectPtr())
+		{
+			It.RemoveCurrent();
+		}
+	}
+}
@@ -28,3 +28,20 @@ void FGSCGameplayEffectContainerSpec::AddTargets(const TArray<FHitResult>& HitRe
 		TargetData.Add(NewData);
 	}
 }
+
+bool FGSCGameplayTagChangeFilter::Matches(const FGameplayTag& InTag) const
+{
+	if (IsEmpty())
+	{
+		return true;
+	}
+
+	if (const bool* bCachedResult = CachedResults.Find(InTag))
+	{
+		return *bCachedResult;
+	}
+
+	const bool bMatches = ExactTags.HasTagExact(InTag) || InTag.MatchesAny(ParentTags);
+	CachedResults.Add(InTag, bMatches);
+	return bMatches;
+}
@@ -2,12 +2,10 @@
 
 #include "Animations/GSCComboWindowNotifyState.h"
 
-#include "GSCLog.h"
 #include "Abilities/GSCBlueprintFunctionLibrary.h"
-#include "Abilities/GSCGameplayAbility.h"
 #include "Components/GSCComboManagerComponent.h"
-#include "Components/GSCCoreComponent.h"
 #include "Components/SkeletalMeshComponent.h"
+#include "Engine/World.h"
 
 void UGSCComboWindowNotifyState::NotifyBegin(USkeletalMeshComponent* MeshComp, UAnimSequenceBase* Animation, float TotalDuration)
 {
@@ -17,16 +15,11 @@ void UGSCComboWindowNotifyState::NotifyBegin(USkeletalMeshComponent* MeshComp, U
 		return;
 	}
 
-	// run only on server
-	if (!Owner->HasAuthority())
-	{
-		return;
-	}
-
+	// run only on server and locally controlled owning client (to predict next combo)
 	UGSCComboManagerComponent* ComboManagerComponent = UGSCBlueprintFunctionLibrary::GetComboManagerComponent(Owner);
-	if (ComboManagerComponent)
+	if (ComboManagerComponent && ComboManagerComponent->CanEvaluateComboWindow())
 	{
-		ComboManagerComponent->bComboWindowOpened = true;
+		ComboManagerComponent->OpenComboWindow(bEndCombo);
 	}
 }
 
@@ -38,71 +31,11 @@ void UGSCComboWindowNotifyState::NotifyEnd(USkeletalMeshComponent* MeshComp, UAn
 		return;
 	}
 
-	// run only on server
-	if (!Owner->HasAuthority())
-	{
-		return;
-	}
-
+	// run only on server and locally controlled owning client (to predict next combo)
 	UGSCComboManagerComponent* ComboManagerComponent = UGSCBlueprintFunctionLibrary::GetComboManagerComponent(Owner);
-	if (ComboManagerComponent)
+	if (ComboManagerComponent && ComboManagerComponent->CanEvaluateComboWindow())
 	{
-		GSC_LOG(Verbose, TEXT("NotifyEnd: bNextComboAbilityActivated %s (%s)"), ComboManagerComponent->bNextComboAbilityActivated ? TEXT("true") : TEXT("false"), *Owner->GetName())
-		GSC_LOG(Verbose, TEXT("NotifyEnd: bEndCombo %s (%s)"), bEndCombo ? TEXT("true") : TEXT("false"), *Owner->GetName())
-		if (!ComboManagerComponent->bNextComboAbilityActivated || bEndCombo)
-		{
-			GSC_LOG(Verbose, TEXT("NotifyEnd: ResetCombo  (%s)"), *Owner->GetName())
-			ComboManagerComponent->ResetCombo();
-		}
-
-		ComboManagerComponent->bComboWindowOpened = false;
-		ComboManagerComponent->bRequestTriggerCombo = false;
-		ComboManagerComponent->bShouldTriggerCombo = false;
-		ComboManagerComponent->bNextComboAbilityActivated = false;
-	}
-}
-
-void UGSCComboWindowNotifyState::NotifyTick(USkeletalMeshComponent* MeshComp, UAnimSequenceBase* Animation, float FrameDeltaTime)
-{
-	const AActor* Owner = GetOwnerActor(MeshComp);
-	if (!Owner)
-	{
-		return;
-	}
-
-	// run only on server
-	if (!Owner->HasAuthority())
-	{
-		return;
-	}
-
-	UGSCComboManagerComponent* ComboManagerComponent = UGSCBlueprintFunctionLibrary::GetComboManagerComponent(Owner);
-	if (!ComboManagerComponent)
-	{
-		return;
-	}
-
-	if (ComboManagerComponent->bComboWindowOpened && ComboManagerComponent->bShouldTriggerCombo && ComboManagerComponent->bRequestTriggerCombo && !bEndCombo)
-	{
-		UGSCCoreComponent* CoreComponent = UGSCBlueprintFunctionLibrary::GetCompanionCoreComponent(Owner);
-		// prevent reactivate of ability in this tick window (especially on networked environment with some lags)
-		if (CoreComponent && !ComboManagerComponent->bNextComboAbilityActivated)
-		{
-			const UGameplayAbility* ComboAbility = ComboManagerComponent->GetCurrentActiveComboAbility();
-			if (ComboAbility)
-			{
-				UGSCGameplayAbility* ActivatedAbility;
-				const bool bSuccess = CoreComponent->ActivateAbilityByClass(ComboAbility->GetClass(), ActivatedAbility);
-				if (bSuccess)
-				{
-					ComboManagerComponent->bNextComboAbilityActivated = true;
-				}
-				else
-				{
-					GSC_LOG(Verbose, TEXT("ComboWindowNotifyState:NotifyTick Ability %s didn't activate"), *ComboAbility->GetClass()->GetName())
-				}
-			}
-		}
+		ComboManagerComponent->CloseComboWindow();
 	}
 }
 
@@ -118,17 +51,11 @@ FString UGSCComboWindowNotifyState::GetNotifyName_Implementation() const
 
 AActor* UGSCComboWindowNotifyState::GetOwnerActor(USkeletalMeshComponent* MeshComponent) const
 {
-	AActor* OwnerActor = MeshComponent->GetOwner();
-	if (!OwnerActor)
-	{
-		return nullptr;
-	}
-
-	const FString ActorName = OwnerActor->GetName();
-	if (ActorName.StartsWith(AnimationEditorPreviewActorString))
+	const UWorld* World = MeshComponent ? MeshComponent->GetWorld() : nullptr;
+	if (!World || World->WorldType == EWorldType::EditorPreview)
 	{
 		return nullptr;
 	}
 
-	return OwnerActor;
+	return MeshComponent->GetOwner();
 }
@@ -5,6 +5,7 @@
 #include "Abilities/GSCBlueprintFunctionLibrary.h"
 #include "Components/GSCComboManagerComponent.h"
 #include "Components/SkeletalMeshComponent.h"
+#include "Engine/World.h"
 
 void UGSCTriggerComboNotify::Notify(USkeletalMeshComponent* MeshComp, UAnimSequenceBase* Animation)
 {
@@ -14,19 +15,14 @@ void UGSCTriggerComboNotify::Notify(USkeletalMeshComponent* MeshComp, UAnimSeque
 		return;
 	}
 
-	// run only on server
-	if (!Owner->HasAuthority())
-	{
-		return;
-	}
-
+	// run only on server and locally controlled owning client (to predict next combo)
 	UGSCComboManagerComponent* ComboManagerComponent = UGSCBlueprintFunctionLibrary::GetComboManagerComponent(Owner);
-	if (!ComboManagerComponent)
+	if (!ComboManagerComponent || !ComboManagerComponent->CanEvaluateComboWindow())
 	{
 		return;
 	}
 
-	ComboManagerComponent->bRequestTriggerCombo = true;
+	ComboManagerComponent->RequestTriggerCombo();
 }
 
 FString UGSCTriggerComboNotify::GetNotifyName_Implementation() const
@@ -36,17 +32,11 @@ FString UGSCTriggerComboNotify::GetNotifyName_Implementation() const
 
 AActor* UGSCTriggerComboNotify::GetOwnerActor(USkeletalMeshComponent* MeshComponent) const
 {
-	AActor* OwnerActor = MeshComponent->GetOwner();
-	if (!OwnerActor)
-	{
-		return nullptr;
-	}
-
-	const FString ActorName = OwnerActor->GetName();
-	if (ActorName.StartsWith(AnimationEditorPreviewActorString))
+	const UWorld* World = MeshComponent ? MeshComponent->GetWorld() : nullptr;
+	if (!World || World->WorldType == EWorldType::EditorPreview)
 	{
 		return nullptr;
 	}
 
-	return OwnerActor;
+	return MeshComponent->GetOwner();
 }
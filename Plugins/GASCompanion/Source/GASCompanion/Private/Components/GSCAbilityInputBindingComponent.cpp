@@ -5,16 +5,25 @@
 #include "AbilitySystemComponent.h"
 #include "AbilitySystemGlobals.h"
 #include "GSCLog.h"
+#include "Abilities/GSCAbilitySystemComponent.h"
+#include "Abilities/GSCInputLatencyTracker.h"
+#include "Subsystems/GSCComponentRegistrySubsystem.h"
 
 namespace GSCAbilityInputBindingComponent_Impl
 {
 	constexpr int32 InvalidInputID = 0;
-	int32 IncrementingInputID = InvalidInputID;
+}
 
-	static int32 GetNextInputID()
-	{
-		return ++IncrementingInputID;
-	}
+void UGSCAbilityInputBindingComponent::OnRegister()
+{
+	Super::OnRegister();
+	UGSCComponentRegistrySubsystem::RegisterComponent(this);
+}
+
+void UGSCAbilityInputBindingComponent::OnUnregister()
+{
+	UGSCComponentRegistrySubsystem::UnregisterComponent(this);
+	Super::OnUnregister();
 }
 
 void UGSCAbilityInputBindingComponent::SetupPlayerControls_Implementation(UEnhancedInputComponent* PlayerInputComponent)
@@ -128,22 +137,24 @@ void UGSCAbilityInputBindingComponent::SetInputBinding(UInputAction* InputAction
 		FGameplayAbilitySpec* OldBoundAbility = FindAbilitySpec(AbilityInputBinding->BoundAbilitiesStack.Top());
 		if (OldBoundAbility && OldBoundAbility->InputID == AbilityInputBinding->InputID)
 		{
-			OldBoundAbility->InputID = InvalidInputID;
+			SetAbilitySpecInputID(AbilityComponent, *OldBoundAbility, InvalidInputID);
 		}
 	}
 	else
 	{
 		AbilityInputBinding = &MappedAbilities.Add(TObjectPtr<UInputAction>(InputAction));
-		AbilityInputBinding->InputID = GetNextInputID();
+		AbilityInputBinding->InputID = GetInputIDAllocator(AbilityComponent).Allocate();
 		AbilityInputBinding->TriggerEvent = TriggerEvent;
+		InputActionsByInputID.Add(AbilityInputBinding->InputID, InputAction);
 	}
 
 	if (BindingAbility)
 	{
-		BindingAbility->InputID = AbilityInputBinding->InputID;
+		SetAbilitySpecInputID(AbilityComponent, *BindingAbility, AbilityInputBinding->InputID);
 	}
 
 	AbilityInputBinding->BoundAbilitiesStack.Push(AbilityHandle);
+	InputIDsByAbilityHandle.Add(AbilityHandle, AbilityInputBinding->InputID);
 	TryBindAbilityInput(InputAction, *AbilityInputBinding);
 }
 
@@ -158,40 +169,32 @@ void UGSCAbilityInputBindingComponent::ClearInputBinding(const FGameplayAbilityS
 	}
 
 	// Find the mapping for this ability
-	auto MappedIterator = MappedAbilities.CreateIterator();
-	while (MappedIterator)
-	{
-		if (MappedIterator.Value().InputID == FoundAbility->InputID)
-		{
-			break;
-		}
-
-		++MappedIterator;
-	}
+	const UInputAction* InputAction = InputActionsByInputID.FindRef(FoundAbility->InputID);
+	FGSCAbilityInputBinding* AbilityInputBinding = InputAction ? MappedAbilities.Find(InputAction) : nullptr;
 
-	if (MappedIterator)
+	if (AbilityInputBinding)
 	{
-		FGSCAbilityInputBinding& AbilityInputBinding = MappedIterator.Value();
-
-		if (AbilityInputBinding.BoundAbilitiesStack.Remove(AbilityHandle) > 0)
+		if (AbilityInputBinding->BoundAbilitiesStack.Remove(AbilityHandle) > 0)
 		{
-			if (AbilityInputBinding.BoundAbilitiesStack.Num() > 0)
+			InputIDsByAbilityHandle.Remove(AbilityHandle);
+
+			if (AbilityInputBinding->BoundAbilitiesStack.Num() > 0)
 			{
-				FGameplayAbilitySpec* StackedAbility = FindAbilitySpec(AbilityInputBinding.BoundAbilitiesStack.Top());
+				FGameplayAbilitySpec* StackedAbility = FindAbilitySpec(AbilityInputBinding->BoundAbilitiesStack.Top());
 				if (StackedAbility && StackedAbility->InputID == 0)
 				{
-					StackedAbility->InputID = AbilityInputBinding.InputID;
+					SetAbilitySpecInputID(AbilityComponent, *StackedAbility, AbilityInputBinding->InputID);
 				}
 			}
 			else
 			{
-				// NOTE: This will invalidate the `AbilityInputBinding` ref above
-				RemoveEntry(MappedIterator.Key());
+				// NOTE: This will invalidate the `AbilityInputBinding` ptr above
+				RemoveEntry(InputAction);
 			}
 			// DO NOT act on `AbilityInputBinding` after here (it could have been removed)
 
 
-			FoundAbility->InputID = InvalidInputID;
+			SetAbilitySpecInputID(AbilityComponent, *FoundAbility, InvalidInputID);
 		}
 	}
 }
@@ -216,8 +219,12 @@ UInputAction* UGSCAbilityInputBindingComponent::GetBoundInputActionForAbility(co
 		return nullptr;
 	}
 
-	// Ensure and update inputs ID for specs based on mapped abilities.
-	UpdateAbilitySystemBindings(AbilitySystemComponent);
+	// Instanced abilities know their spec handle, resolved from the bound handles without touching specs
+	const FGameplayAbilitySpecHandle AbilityHandle = Ability->GetCurrentAbilitySpecHandle();
+	if (const int32* InputID = AbilityHandle.IsValid() ? InputIDsByAbilityHandle.Find(AbilityHandle) : nullptr)
+	{
+		return InputActionsByInputID.FindRef(*InputID);
+	}
 
 	const FGameplayAbilitySpec* AbilitySpec = AbilitySystemComponent->FindAbilitySpecFromClass(Ability->GetClass());
 	if (!AbilitySpec)
@@ -234,18 +241,13 @@ UInputAction* UGSCAbilityInputBindingComponent::GetBoundInputActionForAbilitySpe
 {
 	check(AbilitySpec);
 
-	UInputAction* FoundInputAction = nullptr;
-	for (const TPair<TObjectPtr<UInputAction>, FGSCAbilityInputBinding>& MappedAbility : MappedAbilities)
+	// Bound handles first, spec InputID might have been overridden by replication (usually back to INDEX_NONE, see UpdateAbilitySystemBindings)
+	if (const int32* InputID = InputIDsByAbilityHandle.Find(AbilitySpec->Handle))
 	{
-		const FGSCAbilityInputBinding AbilityInputBinding = MappedAbility.Value;
-		if (AbilityInputBinding.InputID == AbilitySpec->InputID)
-		{
-			FoundInputAction = MappedAbility.Key;
-			break;
-		}
+		return InputActionsByInputID.FindRef(*InputID);
 	}
 
-	return FoundInputAction;
+	return InputActionsByInputID.FindRef(AbilitySpec->InputID);
 }
 
 void UGSCAbilityInputBindingComponent::ResetBindings()
@@ -267,19 +269,33 @@ void UGSCAbilityInputBindingComponent::ResetBindings()
 				FGameplayAbilitySpec* FoundAbility = AbilityComponent->FindAbilitySpecFromHandle(AbilityHandle);
 				if (FoundAbility && FoundAbility->InputID == ExpectedInputID)
 				{
-					FoundAbility->InputID = GSCAbilityInputBindingComponent_Impl::InvalidInputID;
+					SetAbilitySpecInputID(AbilityComponent, *FoundAbility, GSCAbilityInputBindingComponent_Impl::InvalidInputID);
 				}
 			}
 		}
+
+		// Give back the InputID, a new one is allocated on next RunAbilitySystemSetup (the same one if ASC didn't change)
+		GetInputIDAllocator(AbilityComponent).Release(InputBinding.Value.InputID);
+		InputBinding.Value.InputID = GSCAbilityInputBindingComponent_Impl::InvalidInputID;
 	}
 
+	InputActionsByInputID.Reset();
+	InputIDsByAbilityHandle.Reset();
+
 	if (InputComponent)
 	{
 		InputComponent->RemoveBindingByHandle(OnConfirmHandle);
 		InputComponent->RemoveBindingByHandle(OnCancelHandle);
 	}
 
+	if (UGSCAbilitySystemComponent* CompanionASC = Cast<UGSCAbilitySystemComponent>(AbilityComponent))
+	{
+		CompanionASC->OnAbilitySpecsChangedDelegate.Remove(AbilitySpecsChangedHandle);
+	}
+
+	AbilitySpecsChangedHandle.Reset();
 	AbilityComponent = nullptr;
+	bBindingsDirty = true;
 }
 
 void UGSCAbilityInputBindingComponent::RunAbilitySystemSetup()
@@ -287,24 +303,71 @@ void UGSCAbilityInputBindingComponent::RunAbilitySystemSetup()
 	const AActor* MyOwner = GetOwner();
 	check(MyOwner);
 
+	UAbilitySystemComponent* PreviousAbilityComponent = AbilityComponent;
 	AbilityComponent = UAbilitySystemGlobals::GetAbilitySystemComponentFromActor(MyOwner);
-	if (AbilityComponent)
+
+	// ASC changed, specs need to be synced again
+	if (PreviousAbilityComponent != AbilityComponent)
 	{
-		for (auto& InputBinding : MappedAbilities)
+		if (UGSCAbilitySystemComponent* PreviousCompanionASC = Cast<UGSCAbilitySystemComponent>(PreviousAbilityComponent))
 		{
-			const int32 NewInputID = GSCAbilityInputBindingComponent_Impl::GetNextInputID();
-			InputBinding.Value.InputID = NewInputID;
+			PreviousCompanionASC->OnAbilitySpecsChangedDelegate.Remove(AbilitySpecsChangedHandle);
+		}
 
-			for (const FGameplayAbilitySpecHandle AbilityHandle : InputBinding.Value.BoundAbilitiesStack)
+		AbilitySpecsChangedHandle.Reset();
+		if (UGSCAbilitySystemComponent* CompanionASC = Cast<UGSCAbilitySystemComponent>(AbilityComponent))
+		{
+			AbilitySpecsChangedHandle = CompanionASC->OnAbilitySpecsChangedDelegate.AddUObject(this, &UGSCAbilityInputBindingComponent::MarkBindingsDirty);
+		}
+	}
+
+	MarkBindingsDirty();
+
+	// Release first (to the allocator they were allocated from), so that reallocating yields the lowest InputIDs
+	FGSCInputIDAllocator& PreviousAllocator = GetInputIDAllocator(PreviousAbilityComponent);
+	for (const TPair<TObjectPtr<UInputAction>, FGSCAbilityInputBinding>& InputBinding : MappedAbilities)
+	{
+		PreviousAllocator.Release(InputBinding.Value.InputID);
+	}
+
+	FGSCInputIDAllocator& Allocator = GetInputIDAllocator(AbilityComponent);
+	for (auto& InputBinding : MappedAbilities)
+	{
+		const int32 NewInputID = Allocator.Allocate();
+		InputBinding.Value.InputID = NewInputID;
+
+		if (!AbilityComponent)
+		{
+			continue;
+		}
+
+		for (const FGameplayAbilitySpecHandle AbilityHandle : InputBinding.Value.BoundAbilitiesStack)
+		{
+			FGameplayAbilitySpec* FoundAbility = AbilityComponent->FindAbilitySpecFromHandle(AbilityHandle);
+			if (FoundAbility != nullptr)
 			{
-				FGameplayAbilitySpec* FoundAbility = AbilityComponent->FindAbilitySpecFromHandle(AbilityHandle);
-				if (FoundAbility != nullptr)
-				{
-					FoundAbility->InputID = NewInputID;
-				}
+				SetAbilitySpecInputID(AbilityComponent, *FoundAbility, NewInputID);
 			}
 		}
 	}
+
+	RebuildInputIDIndexes();
+}
+
+void UGSCAbilityInputBindingComponent::RebuildInputIDIndexes()
+{
+	InputActionsByInputID.Reset();
+	InputIDsByAbilityHandle.Reset();
+
+	for (const TPair<TObjectPtr<UInputAction>, FGSCAbilityInputBinding>& InputBinding : MappedAbilities)
+	{
+		InputActionsByInputID.Add(InputBinding.Value.InputID, InputBinding.Key);
+
+		for (const FGameplayAbilitySpecHandle& AbilityHandle : InputBinding.Value.BoundAbilitiesStack)
+		{
+			InputIDsByAbilityHandle.Add(AbilityHandle, InputBinding.Value.InputID);
+		}
+	}
 }
 
 void UGSCAbilityInputBindingComponent::UpdateAbilitySystemBindings(UAbilitySystemComponent* AbilitySystemComponent)
@@ -328,25 +391,41 @@ void UGSCAbilityInputBindingComponent::UpdateAbilitySystemBindings(UAbilitySyste
 			FGameplayAbilitySpec* FoundAbility = AbilitySystemComponent->FindAbilitySpecFromHandle(AbilityHandle);
 			if (FoundAbility != nullptr)
 			{
-				FoundAbility->InputID = InputID;
+				SetAbilitySpecInputID(AbilitySystemComponent, *FoundAbility, InputID);
 			}
 		}
 	}
 }
 
+void UGSCAbilityInputBindingComponent::SyncAbilitySystemBindings()
+{
+	if (!AbilityComponent || !bBindingsDirty)
+	{
+		return;
+	}
+
+	UpdateAbilitySystemBindings(AbilityComponent);
+
+	// Only Companion ASCs notify us about spec changes, stay dirty otherwise
+	bBindingsDirty = !AbilitySpecsChangedHandle.IsValid();
+}
+
+void UGSCAbilityInputBindingComponent::MarkBindingsDirty()
+{
+	bBindingsDirty = true;
+}
+
 // ReSharper disable once CppParameterMayBeConstPtrOrRef
 void UGSCAbilityInputBindingComponent::OnAbilityInputPressed(UInputAction* InputAction)
 {
 	// The AbilitySystemComponent may not have been valid when we first bound input... try again.
-	if (AbilityComponent)
-	{
-		UpdateAbilitySystemBindings(AbilityComponent);
-	}
-	else
+	if (!AbilityComponent)
 	{
 		RunAbilitySystemSetup();
 	}
 
+	SyncAbilitySystemBindings();
+
 	if (AbilityComponent)
 	{
 		using namespace GSCAbilityInputBindingComponent_Impl;
@@ -354,6 +433,7 @@ void UGSCAbilityInputBindingComponent::OnAbilityInputPressed(UInputAction* Input
 		const FGSCAbilityInputBinding* FoundBinding = MappedAbilities.Find(InputAction);
 		if (FoundBinding && ensure(FoundBinding->InputID != InvalidInputID))
 		{
+			FGSCInputLatencyTracker::Get().BeginInput(AbilityComponent, FoundBinding->InputID);
 			AbilityComponent->AbilityLocalInputPressed(FoundBinding->InputID);
 		}
 	}
@@ -363,7 +443,7 @@ void UGSCAbilityInputBindingComponent::OnAbilityInputPressed(UInputAction* Input
 void UGSCAbilityInputBindingComponent::OnAbilityInputReleased(UInputAction* InputAction)
 {
 	// The AbilitySystemComponent may need to have specs inputID updated here for clients... try again.
-	UpdateAbilitySystemBindings(AbilityComponent);
+	SyncAbilitySystemBindings();
 
 	if (AbilityComponent)
 	{
@@ -415,14 +495,48 @@ void UGSCAbilityInputBindingComponent::RemoveEntry(const UInputAction* InputActi
 			FGameplayAbilitySpec* AbilitySpec = FindAbilitySpec(AbilityHandle);
 			if (AbilitySpec && AbilitySpec->InputID == Bindings->InputID)
 			{
-				AbilitySpec->InputID = InvalidInputID;
+				SetAbilitySpecInputID(AbilityComponent, *AbilitySpec, InvalidInputID);
+			}
+
+			// Handle might have been pushed to another binding since
+			if (InputIDsByAbilityHandle.FindRef(AbilityHandle) == Bindings->InputID)
+			{
+				InputIDsByAbilityHandle.Remove(AbilityHandle);
 			}
 		}
 
+		InputActionsByInputID.Remove(Bindings->InputID);
+		GetInputIDAllocator(AbilityComponent).Release(Bindings->InputID);
 		MappedAbilities.Remove(InputAction);
 	}
 }
 
+void UGSCAbilityInputBindingComponent::SetAbilitySpecInputID(UAbilitySystemComponent* AbilitySystemComponent, FGameplayAbilitySpec& AbilitySpec, const int32 InputID)
+{
+	if (AbilitySpec.InputID == InputID)
+	{
+		return;
+	}
+
+	AbilitySpec.InputID = InputID;
+
+	// Let Companion ASC know its InputID index needs to be rebuilt
+	if (UGSCAbilitySystemComponent* CompanionASC = Cast<UGSCAbilitySystemComponent>(AbilitySystemComponent))
+	{
+		CompanionASC->MarkAbilitySpecInputIDsDirty();
+	}
+}
+
+FGSCInputIDAllocator& UGSCAbilityInputBindingComponent::GetInputIDAllocator(UAbilitySystemComponent* InAbilitySystemComponent)
+{
+	if (UGSCAbilitySystemComponent* CompanionASC = Cast<UGSCAbilitySystemComponent>(InAbilitySystemComponent))
+	{
+		return CompanionASC->GetInputIDAllocator();
+	}
+
+	return InputIDAllocator;
+}
+
 FGameplayAbilitySpec* UGSCAbilityInputBindingComponent::FindAbilitySpec(const FGameplayAbilitySpecHandle Handle) const
 {
 	FGameplayAbilitySpec* FoundAbility = nullptr;
@@ -7,16 +7,18 @@
 #include "GSCDelegates.h"
 #include "GSCLog.h"
 #include "Abilities/GSCGameplayAbility.h"
+#include "Abilities/GSCInputLatencyTracker.h"
+#include "Engine/World.h"
 #include "GameFramework/Pawn.h"
+#include "Subsystems/GSCComponentRegistrySubsystem.h"
 
 // Sets default values for this component's properties
 UGSCAbilityQueueComponent::UGSCAbilityQueueComponent()
 {
-	// Set this component to be initialized when the game starts, and to be ticked every frame.  You can turn these features
-	// off to improve performance if you don't need them.
-	PrimaryComponentTick.bCanEverTick = true;
+	// Queue is fully event driven (ability ended / failed callbacks), no need for ticking
+	PrimaryComponentTick.bCanEverTick = false;
+	PrimaryComponentTick.bStartWithTickEnabled = false;
 
-	// ...
 	SetIsReplicatedByDefault(true);
 }
 
@@ -29,6 +31,18 @@ void UGSCAbilityQueueComponent::BeginPlay()
 	SetupOwner();
 }
 
+void UGSCAbilityQueueComponent::OnRegister()
+{
+	Super::OnRegister();
+	UGSCComponentRegistrySubsystem::RegisterComponent(this);
+}
+
+void UGSCAbilityQueueComponent::OnUnregister()
+{
+	UGSCComponentRegistrySubsystem::UnregisterComponent(this);
+	Super::OnUnregister();
+}
+
 void UGSCAbilityQueueComponent::SetupOwner()
 {
 	if(!GetOwner())
@@ -79,6 +93,12 @@ void UGSCAbilityQueueComponent::UpdateAllowedAbilitiesForAbilityQueue(TArray<TSu
 
 	QueuedAllowedAbilities = AllowedAbilities;
 
+	QueuedAllowedAbilitiesSet.Reset();
+	for (const TSubclassOf<UGameplayAbility>& AllowedAbility : QueuedAllowedAbilities)
+	{
+		QueuedAllowedAbilitiesSet.Add(TObjectKey<UClass>(AllowedAbility.Get()));
+	}
+
 	// Notify Debug Widget if any is on screen
 	UpdateDebugWidgetAllowedAbilities();
 }
@@ -107,7 +127,23 @@ bool UGSCAbilityQueueComponent::IsAllAbilitiesAllowedForAbilityQueue() const
 
 const UGameplayAbility* UGSCAbilityQueueComponent::GetCurrentQueuedAbility() const
 {
-	return QueuedAbility;
+	const int32 Offset = FindQueuedRequestToActivate(GetWorldTime());
+	if (Offset == INDEX_NONE)
+	{
+		return nullptr;
+	}
+
+	return QueuedRequests[(QueuedRequestsHead + Offset) % QueuedRequests.Num()].Ability;
+}
+
+bool UGSCAbilityQueueComponent::IsAbilityAllowedForAbilityQueue(const UClass* InAbilityClass) const
+{
+	return bAllowAllAbilitiesForAbilityQueue || QueuedAllowedAbilitiesSet.Contains(TObjectKey<UClass>(InAbilityClass));
+}
+
+void UGSCAbilityQueueComponent::ResetAbilityQueueStats()
+{
+	AbilityQueueStats = FGSCAbilityQueueStats();
 }
 
 TArray<TSubclassOf<UGameplayAbility>> UGSCAbilityQueueComponent::GetQueuedAllowedAbilities() const
@@ -149,55 +185,179 @@ void UGSCAbilityQueueComponent::OnAbilityEnded(const UGameplayAbility* InAbility
 
 	if (bAbilityQueueEnabled)
 	{
-		if (QueuedAbility)
+		ActivateQueuedRequest();
+	}
+}
+
+void UGSCAbilityQueueComponent::OnAbilityFailed(const UGameplayAbility* Ability, const FGameplayTagContainer& ReasonTags)
+{
+	GSC_LOG(Verbose, TEXT("UGSCAbilityQueueComponent::OnAbilityFailed() %s, Reason: %s"), *Ability->GetName(), *ReasonTags.ToStringSimple())
+	if (bAbilityQueueEnabled && bAbilityQueueOpened)
+	{
+		GSC_LOG(Verbose, TEXT("UGSCAbilityQueueComponent::OnAbilityFailed() Set QueuedAbility to %s"), *Ability->GetName())
+
+		// Only queue the ability if it's allowed (or AllowAllAbilities is turned on)
+		if (IsAbilityAllowedForAbilityQueue(Ability->GetClass()))
 		{
-			// Store queue ability in a local var, it is cleared in ResetAbilityQueueState
-			const UGameplayAbility* AbilityToActivate = QueuedAbility;
-			GSC_LOG(Log, TEXT("UGSCAbilityQueueComponent::OnAbilityEnded() has a queued input: %s [AbilityQueueSystem]"), *AbilityToActivate->GetName())
-			if (bAllowAllAbilitiesForAbilityQueue || QueuedAllowedAbilities.Contains(AbilityToActivate->GetClass()))
-			{
-				ResetAbilityQueueState();
+			FGSCAbilityQueueRequest Request;
+			Request.Ability = const_cast<UGameplayAbility*>(Ability);
+			Request.Timestamp = GetWorldTime();
 
-				GSC_LOG(Log, TEXT("UGSCAbilityQueueComponent::OnAbilityEnded() %s is within Allowed Abilties, try activate [AbilityQueueSystem]"), *AbilityToActivate->GetName())
-				if (OwnerAbilitySystemComponent)
-				{
-					OwnerAbilitySystemComponent->TryActivateAbilityByClass(AbilityToActivate->GetClass());
-				}
+			// Failed ability might be the CDO (non instanced or not yet instanced abilities), resolve the spec from class in that case
+			const FGameplayAbilitySpec* Spec = nullptr;
+			if (OwnerAbilitySystemComponent)
+			{
+				const FGameplayAbilitySpecHandle SpecHandle = Ability->GetCurrentAbilitySpecHandle();
+				Spec = SpecHandle.IsValid() ? OwnerAbilitySystemComponent->FindAbilitySpecFromHandle(SpecHandle) : OwnerAbilitySystemComponent->FindAbilitySpecFromClass(Ability->GetClass());
 			}
-			else
+
+			if (Spec)
 			{
-				ResetAbilityQueueState();
-				GSC_LOG(Verbose, TEXT("UGSCAbilityQueueComponent::OnAbilityEnded() not allowed ability, do nothing: %s [AbilityQueueSystem]"), *AbilityToActivate->GetName())
+				Request.SpecHandle = Spec->Handle;
+				Request.InputID = Spec->InputID;
 			}
+
+			PushQueuedRequest(Request);
+		}
+	}
+}
+
+void UGSCAbilityQueueComponent::PushQueuedRequest(const FGSCAbilityQueueRequest& InRequest)
+{
+	const int32 Capacity = FMath::Max(AbilityQueueBufferSize, 1);
+	if (QueuedRequests.Num() != Capacity)
+	{
+		// Buffer size changed (or first request), previously buffered requests are discarded
+		AbilityQueueStats.Misses += QueuedRequestsNum;
+		QueuedRequests.Reset();
+		QueuedRequests.SetNum(Capacity);
+		QueuedRequestsHead = 0;
+		QueuedRequestsNum = 0;
+	}
+
+	if (QueuedRequestsNum == Capacity)
+	{
+		// Full, discard the oldest request
+		QueuedRequests[QueuedRequestsHead] = FGSCAbilityQueueRequest();
+		QueuedRequestsHead = (QueuedRequestsHead + 1) % Capacity;
+		--QueuedRequestsNum;
+		++AbilityQueueStats.Superseded;
+	}
+
+	QueuedRequests[(QueuedRequestsHead + QueuedRequestsNum) % Capacity] = InRequest;
+	++QueuedRequestsNum;
+
+	FGSCInputLatencyTracker::Get().MarkStage(OwnerAbilitySystemComponent, EGSCInputLatencyStage::QueueGating);
+}
+
+void UGSCAbilityQueueComponent::ActivateQueuedRequest()
+{
+	const double Now = GetWorldTime();
+	const int32 OffsetToActivate = FindQueuedRequestToActivate(Now);
+
+	// Copied, buffer is cleared in ResetAbilityQueueState
+	FGSCAbilityQueueRequest RequestToActivate;
+	if (OffsetToActivate != INDEX_NONE)
+	{
+		RequestToActivate = QueuedRequests[(QueuedRequestsHead + OffsetToActivate) % QueuedRequests.Num()];
+	}
+
+	for (int32 Offset = 0; Offset < QueuedRequestsNum; ++Offset)
+	{
+		if (Offset == OffsetToActivate)
+		{
+			continue;
+		}
+
+		const FGSCAbilityQueueRequest& Request = QueuedRequests[(QueuedRequestsHead + Offset) % QueuedRequests.Num()];
+		if (IsQueuedRequestExpired(Request, Now))
+		{
+			GSC_LOG(Verbose, TEXT("UGSCAbilityQueueComponent::ActivateQueuedRequest() expired queued input: %s [AbilityQueueSystem]"), *GetNameSafe(Request.Ability))
+			++AbilityQueueStats.Expired;
+		}
+		else if (!IsQueuedRequestAllowed(Request))
+		{
+			GSC_LOG(Verbose, TEXT("UGSCAbilityQueueComponent::ActivateQueuedRequest() not allowed ability, do nothing: %s [AbilityQueueSystem]"), *GetNameSafe(Request.Ability))
+			++AbilityQueueStats.Misses;
 		}
 		else
 		{
-			ResetAbilityQueueState();
+			GSC_LOG(Verbose, TEXT("UGSCAbilityQueueComponent::ActivateQueuedRequest() superseded by %s queued earlier, do nothing: %s [AbilityQueueSystem]"), *GetNameSafe(RequestToActivate.Ability), *GetNameSafe(Request.Ability))
+			++AbilityQueueStats.Superseded;
 		}
 	}
+
+	ResetAbilityQueueState();
+
+	if (OffsetToActivate == INDEX_NONE)
+	{
+		return;
+	}
+
+	GSC_LOG(Log, TEXT("UGSCAbilityQueueComponent::ActivateQueuedRequest() %s is within Allowed Abilties, try activate (InputID: %d) [AbilityQueueSystem]"), *RequestToActivate.Ability->GetName(), RequestToActivate.InputID)
+
+	// Activate directly from the spec resolved when queued, instead of searching activatable abilities by class
+	bool bActivated = false;
+	if (OwnerAbilitySystemComponent)
+	{
+		bActivated = OwnerAbilitySystemComponent->FindAbilitySpecFromHandle(RequestToActivate.SpecHandle) ?
+			OwnerAbilitySystemComponent->TryActivateAbility(RequestToActivate.SpecHandle) :
+			OwnerAbilitySystemComponent->TryActivateAbilityByClass(RequestToActivate.Ability->GetClass());
+	}
+
+	if (bActivated)
+	{
+		++AbilityQueueStats.Hits;
+	}
+	else
+	{
+		++AbilityQueueStats.Misses;
+	}
 }
 
-void UGSCAbilityQueueComponent::OnAbilityFailed(const UGameplayAbility* Ability, const FGameplayTagContainer& ReasonTags)
+int32 UGSCAbilityQueueComponent::FindQueuedRequestToActivate(const double InNow) const
 {
-	GSC_LOG(Verbose, TEXT("UGSCAbilityQueueComponent::OnAbilityFailed() %s, Reason: %s"), *Ability->GetName(), *ReasonTags.ToStringSimple())
-	if (bAbilityQueueEnabled && bAbilityQueueOpened)
+	for (int32 Offset = 0; Offset < QueuedRequestsNum; ++Offset)
 	{
-		GSC_LOG(Verbose, TEXT("UGSCAbilityQueueComponent::OnAbilityFailed() Set QueuedAbility to %s"), *Ability->GetName())
-
-		// Only queue the ability if it's allowed (or AllowAllAbilities is turned on)
-		if (bAllowAllAbilitiesForAbilityQueue || QueuedAllowedAbilities.Contains(Ability->GetClass()))
+		const FGSCAbilityQueueRequest& Request = QueuedRequests[(QueuedRequestsHead + Offset) % QueuedRequests.Num()];
+		if (!IsQueuedRequestExpired(Request, InNow) && IsQueuedRequestAllowed(Request))
 		{
-			QueuedAbility = TObjectPtr<UGameplayAbility>(const_cast<UGameplayAbility*>(Ability));
+			return Offset;
 		}
 	}
+
+	return INDEX_NONE;
+}
+
+bool UGSCAbilityQueueComponent::IsQueuedRequestExpired(const FGSCAbilityQueueRequest& InRequest, const double InNow) const
+{
+	return AbilityQueueExpiry > 0.f && InNow - InRequest.Timestamp > AbilityQueueExpiry;
+}
+
+bool UGSCAbilityQueueComponent::IsQueuedRequestAllowed(const FGSCAbilityQueueRequest& InRequest) const
+{
+	return InRequest.Ability && IsAbilityAllowedForAbilityQueue(InRequest.Ability->GetClass());
+}
+
+double UGSCAbilityQueueComponent::GetWorldTime() const
+{
+	const UWorld* World = GetWorld();
+	return World ? World->GetTimeSeconds() : 0.0;
 }
 
 void UGSCAbilityQueueComponent::ResetAbilityQueueState()
 {
 	GSC_LOG(Verbose, TEXT("UGSCAbilityQueueComponent::ResetAbilityQueueState()"))
-	QueuedAbility = nullptr;
+	for (int32 Offset = 0; Offset < QueuedRequestsNum; ++Offset)
+	{
+		QueuedRequests[(QueuedRequestsHead + Offset) % QueuedRequests.Num()] = FGSCAbilityQueueRequest();
+	}
+
+	QueuedRequestsHead = 0;
+	QueuedRequestsNum = 0;
 	bAllowAllAbilitiesForAbilityQueue = false;
 	QueuedAllowedAbilities.Empty();
+	QueuedAllowedAbilitiesSet.Reset();
 
 	// Notify Debug Widget if any is on screen
 	UpdateDebugWidgetAllowedAbilities();
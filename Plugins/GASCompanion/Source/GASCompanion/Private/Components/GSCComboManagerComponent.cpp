@@ -10,13 +10,45 @@
 #include "Net/UnrealNetwork.h"
 #include "GameFramework/Character.h"
 #include "GSCLog.h"
+#include "Subsystems/GSCComponentRegistrySubsystem.h"
+
+bool FGSCComboReplicatedState::NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess)
+{
+	uint8 Flags = 0;
+	if (Ar.IsSaving())
+	{
+		Flags |= bComboWindowOpened ? 1 << 0 : 0;
+		Flags |= bShouldTriggerCombo ? 1 << 1 : 0;
+		Flags |= bRequestTriggerCombo ? 1 << 2 : 0;
+		Flags |= bNextComboAbilityActivated ? 1 << 3 : 0;
+	}
+
+	Ar.SerializeBits(&Flags, 4);
+
+	// Combo index is usually a single digit, packed down to a single byte
+	uint32 PackedComboIndex = static_cast<uint32>(ComboIndex);
+	Ar.SerializeIntPacked(PackedComboIndex);
+
+	if (Ar.IsLoading())
+	{
+		ComboIndex = static_cast<int32>(PackedComboIndex);
+		bComboWindowOpened = (Flags & 1 << 0) != 0;
+		bShouldTriggerCombo = (Flags & 1 << 1) != 0;
+		bRequestTriggerCombo = (Flags & 1 << 2) != 0;
+		bNextComboAbilityActivated = (Flags & 1 << 3) != 0;
+	}
+
+	bOutSuccess = true;
+	return true;
+}
 
 UGSCComboManagerComponent::UGSCComboManagerComponent()
 {
-	PrimaryComponentTick.bCanEverTick = true;
+	// Combo state is driven by ability activation and anim notifies, no need for ticking
+	PrimaryComponentTick.bCanEverTick = false;
+	PrimaryComponentTick.bStartWithTickEnabled = false;
 	SetIsReplicatedByDefault(true);
 
-
 	MeleeBaseAbility = UGSCGameplayAbility_MeleeBase::StaticClass();
 }
 
@@ -24,11 +56,40 @@ void UGSCComboManagerComponent::GetLifetimeReplicatedProps(TArray<FLifetimePrope
 {
 	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
 
-	DOREPLIFETIME_CONDITION_NOTIFY(UGSCComboManagerComponent, ComboIndex, COND_None, REPNOTIFY_Always);
-	DOREPLIFETIME_CONDITION_NOTIFY(UGSCComboManagerComponent, bComboWindowOpened, COND_None, REPNOTIFY_Always);
-	DOREPLIFETIME_CONDITION_NOTIFY(UGSCComboManagerComponent, bShouldTriggerCombo, COND_None, REPNOTIFY_Always);
-	DOREPLIFETIME_CONDITION_NOTIFY(UGSCComboManagerComponent, bRequestTriggerCombo, COND_None, REPNOTIFY_Always);
-	DOREPLIFETIME_CONDITION_NOTIFY(UGSCComboManagerComponent, bNextComboAbilityActivated, COND_None, REPNOTIFY_Always);
+	// Window / trigger flags are internal to the owner, others only need the combo index
+	DOREPLIFETIME_CONDITION_NOTIFY(UGSCComboManagerComponent, ComboIndex, COND_SkipOwner, REPNOTIFY_OnChanged);
+	DOREPLIFETIME_CONDITION_NOTIFY(UGSCComboManagerComponent, ComboState, COND_OwnerOnly, REPNOTIFY_OnChanged);
+}
+
+void UGSCComboManagerComponent::PreReplication(IRepChangedPropertyTracker& ChangedPropertyTracker)
+{
+	Super::PreReplication(ChangedPropertyTracker);
+
+	ComboState.ComboIndex = ComboIndex;
+	ComboState.bComboWindowOpened = bComboWindowOpened;
+	ComboState.bShouldTriggerCombo = bShouldTriggerCombo;
+	ComboState.bRequestTriggerCombo = bRequestTriggerCombo;
+	ComboState.bNextComboAbilityActivated = bNextComboAbilityActivated;
+}
+
+void UGSCComboManagerComponent::OnRep_ComboState()
+{
+	// Keep predicted combo index until server confirms or rejects it
+	if (PendingComboPredictions == 0)
+	{
+		ComboIndex = ComboState.ComboIndex;
+	}
+
+	// Window and trigger are evaluated locally when locally controlled
+	if (IsOwnerLocallyControlled())
+	{
+		return;
+	}
+
+	bComboWindowOpened = ComboState.bComboWindowOpened;
+	bShouldTriggerCombo = ComboState.bShouldTriggerCombo;
+	bRequestTriggerCombo = ComboState.bRequestTriggerCombo;
+	bNextComboAbilityActivated = ComboState.bNextComboAbilityActivated;
 }
 
 void UGSCComboManagerComponent::IncrementCombo()
@@ -47,14 +108,16 @@ void UGSCComboManagerComponent::ResetCombo()
 
 void UGSCComboManagerComponent::ActivateComboAbility(const TSubclassOf<UGSCGameplayAbility> AbilityClass, const bool bAllowRemoteActivation)
 {
-	if (IsOwnerActorAuthoritative())
-	{
-		ActivateComboAbilityInternal(AbilityClass, bAllowRemoteActivation);
-	}
-	else
+	if (!CanEvaluateComboWindow() && OwnerCoreComponent && AbilityClass && OwnerCoreComponent->IsUsingAbilityByClass(AbilityClass))
 	{
+		// Combo in progress and combo window isn't evaluated here, leave it to server
 		ServerActivateComboAbility(AbilityClass, bAllowRemoteActivation);
+		return;
 	}
+
+	// On owning clients, combo start and next combo are activated locally with prediction. Server confirms or rejects them
+	// through GAS (see UGSCGameplayAbility_MeleeBase::CanActivateAbility), montage is replicated from there.
+	ActivateComboAbilityInternal(AbilityClass, bAllowRemoteActivation);
 }
 
 void UGSCComboManagerComponent::SetComboIndex(const int32 InComboIndex)
@@ -70,11 +133,144 @@ void UGSCComboManagerComponent::SetComboIndex(const int32 InComboIndex)
 	}
 }
 
+void UGSCComboManagerComponent::OnComboAbilityActivated(const FGameplayAbilityActivationInfo& ActivationInfo)
+{
+	const int32 PreviousComboIndex = ComboIndex;
+	IncrementCombo();
+
+	// Not within a combo window (combo start), nothing else to do
+	if (ComboIndex == PreviousComboIndex)
+	{
+		return;
+	}
+
+	// Also set here for next combo activated by a predicting client, which never goes through TryTriggerNextCombo on server
+	bNextComboAbilityActivated = true;
+
+	if (IsOwnerActorAuthoritative())
+	{
+		return;
+	}
+
+	// Predicted next combo, restore combo index if server rejects it (ability itself is ended by GAS)
+	FPredictionKey PredictionKey = ActivationInfo.GetActivationPredictionKey();
+	if (PredictionKey.IsValidKey())
+	{
+		PendingComboPredictions++;
+		PredictionKey.NewRejectedDelegate().BindUObject(this, &UGSCComboManagerComponent::OnPredictedComboRejected, PreviousComboIndex);
+		PredictionKey.NewCaughtUpDelegate().BindUObject(this, &UGSCComboManagerComponent::OnPredictedComboCaughtUp);
+	}
+}
+
+void UGSCComboManagerComponent::OnPredictedComboRejected(const int32 InPreviousComboIndex)
+{
+	GSC_LOG(Verbose, TEXT("UGSCComboManagerComponent::OnPredictedComboRejected() Restore combo index to %d (%s)"), InPreviousComboIndex, *GetNameSafe(GetOwner()))
+	PendingComboPredictions = FMath::Max(PendingComboPredictions - 1, 0);
+	ComboIndex = InPreviousComboIndex;
+	bNextComboAbilityActivated = false;
+}
+
+void UGSCComboManagerComponent::OnPredictedComboCaughtUp()
+{
+	PendingComboPredictions = FMath::Max(PendingComboPredictions - 1, 0);
+}
+
+bool UGSCComboManagerComponent::CanActivateNextCombo() const
+{
+	return bComboWindowOpened && !bComboWindowEndsCombo && !bNextComboAbilityActivated;
+}
+
+void UGSCComboManagerComponent::OpenComboWindow(const bool bInEndCombo)
+{
+	bComboWindowOpened = true;
+	bComboWindowEndsCombo = bInEndCombo;
+
+	TryTriggerNextCombo();
+}
+
+void UGSCComboManagerComponent::CloseComboWindow()
+{
+	GSC_LOG(Verbose, TEXT("CloseComboWindow: bNextComboAbilityActivated %s (%s)"), bNextComboAbilityActivated ? TEXT("true") : TEXT("false"), *GetNameSafe(GetOwner()))
+	GSC_LOG(Verbose, TEXT("CloseComboWindow: bEndCombo %s (%s)"), bComboWindowEndsCombo ? TEXT("true") : TEXT("false"), *GetNameSafe(GetOwner()))
+	if (!bNextComboAbilityActivated || bComboWindowEndsCombo)
+	{
+		GSC_LOG(Verbose, TEXT("CloseComboWindow: ResetCombo  (%s)"), *GetNameSafe(GetOwner()))
+		if (IsOwnerActorAuthoritative())
+		{
+			ResetCombo();
+		}
+		else
+		{
+			// Server resets its own combo when its window closes
+			ComboIndex = 0;
+		}
+	}
+
+	bComboWindowOpened = false;
+	bComboWindowEndsCombo = false;
+	bRequestTriggerCombo = false;
+	bShouldTriggerCombo = false;
+	bNextComboAbilityActivated = false;
+}
+
+void UGSCComboManagerComponent::RequestTriggerCombo()
+{
+	bRequestTriggerCombo = true;
+
+	TryTriggerNextCombo();
+}
+
+bool UGSCComboManagerComponent::TryTriggerNextCombo()
+{
+	// Combo window state is only driven on server and locally controlled owning client
+	if (!CanEvaluateComboWindow())
+	{
+		return false;
+	}
+
+	// prevent reactivate of ability within the same window (especially on networked environment with some lags)
+	if (!bShouldTriggerCombo || !bRequestTriggerCombo || !CanActivateNextCombo())
+	{
+		return false;
+	}
+
+	if (!OwnerCoreComponent)
+	{
+		return false;
+	}
+
+	const UGameplayAbility* ComboAbility = GetCurrentActiveComboAbility();
+	if (!ComboAbility)
+	{
+		return false;
+	}
+
+	UGSCGameplayAbility* ActivatedAbility;
+	if (!OwnerCoreComponent->ActivateAbilityByClass(ComboAbility->GetClass(), ActivatedAbility))
+	{
+		GSC_LOG(Verbose, TEXT("UGSCComboManagerComponent::TryTriggerNextCombo() Ability %s didn't activate"), *ComboAbility->GetClass()->GetName())
+		return false;
+	}
+
+	bNextComboAbilityActivated = true;
+	return true;
+}
+
 bool UGSCComboManagerComponent::IsOwnerActorAuthoritative() const
 {
 	return !bCachedIsNetSimulated;
 }
 
+bool UGSCComboManagerComponent::IsOwnerLocallyControlled() const
+{
+	return OwningCharacter && OwningCharacter->IsLocallyControlled();
+}
+
+bool UGSCComboManagerComponent::CanEvaluateComboWindow() const
+{
+	return IsOwnerActorAuthoritative() || IsOwnerLocallyControlled();
+}
+
 // Called when the game starts
 void UGSCComboManagerComponent::BeginPlay()
 {
@@ -93,6 +289,14 @@ void UGSCComboManagerComponent::OnRegister()
 
 	// Cached off netrole to avoid constant checking on owning actor
 	CacheIsNetSimulated();
+
+	UGSCComponentRegistrySubsystem::RegisterComponent(this);
+}
+
+void UGSCComboManagerComponent::OnUnregister()
+{
+	UGSCComponentRegistrySubsystem::UnregisterComponent(this);
+	Super::OnUnregister();
 }
 
 void UGSCComboManagerComponent::SetupOwner()
@@ -119,8 +323,7 @@ UGameplayAbility* UGSCComboManagerComponent::GetCurrentActiveComboAbility() cons
 		return nullptr;
 	}
 
-	TArray<UGameplayAbility*> Abilities = OwnerCoreComponent->GetActiveAbilitiesByClass(MeleeBaseAbility);
-	return Abilities.IsValidIndex(0) ? Abilities[0] : nullptr;
+	return OwnerCoreComponent->GetFirstActiveAbilityByClass(MeleeBaseAbility);
 }
 
 void UGSCComboManagerComponent::ActivateComboAbilityInternal(const TSubclassOf<UGSCGameplayAbility> AbilityClass, const bool bAllowRemoteActivation)
@@ -158,6 +361,9 @@ void UGSCComboManagerComponent::ActivateComboAbilityInternal(const TSubclassOf<U
 			bComboWindowOpened ? TEXT("true") : TEXT("false")
 		)
 		bShouldTriggerCombo = bComboWindowOpened;
+
+		// Trigger notify might have been reached already within this window
+		TryTriggerNextCombo();
 	}
 	else
 	{
@@ -174,26 +380,11 @@ void UGSCComboManagerComponent::CacheIsNetSimulated()
 
 void UGSCComboManagerComponent::ServerSetComboIndex_Implementation(const int32 InComboIndex)
 {
-	MulticastSetComboIndex(InComboIndex);
-}
-
-void UGSCComboManagerComponent::MulticastSetComboIndex_Implementation(const int32 InComboIndex)
-{
-	if (OwningCharacter && !OwningCharacter->IsLocallyControlled())
-	{
-		ComboIndex = InComboIndex;
-	}
-}
-
-void UGSCComboManagerComponent::MulticastActivateComboAbility_Implementation(const TSubclassOf<UGSCGameplayAbility> AbilityClass, const bool bAllowRemoteActivation)
-{
-    if (OwningCharacter && !OwningCharacter->IsLocallyControlled())
-    {
-        ActivateComboAbilityInternal(AbilityClass, bAllowRemoteActivation);
-    }
+	// Simulated proxies get it from ComboIndex replication
+	ComboIndex = InComboIndex;
 }
 
 void UGSCComboManagerComponent::ServerActivateComboAbility_Implementation(const TSubclassOf<UGSCGameplayAbility> AbilityClass, const bool bAllowRemoteActivation)
 {
-    MulticastActivateComboAbility(AbilityClass, bAllowRemoteActivation);
+	ActivateComboAbilityInternal(AbilityClass, bAllowRemoteActivation);
 }
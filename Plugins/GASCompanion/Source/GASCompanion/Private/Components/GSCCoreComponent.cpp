@@ -5,11 +5,15 @@
 
 #include "AbilitySystemBlueprintLibrary.h"
 #include "AbilitySystemComponent.h"
+#include "Abilities/GSCAbilitySystemComponent.h"
 #include "Abilities/GSCGameplayAbility.h"
 #include "Abilities/Attributes/GSCAttributeSet.h"
 #include "Core/Settings/GSCDeveloperSettings.h"
 #include "GameFramework/Character.h"
 #include "GSCLog.h"
+#include "GSCStats.h"
+#include "Misc/CoreDelegates.h"
+#include "Subsystems/GSCComponentRegistrySubsystem.h"
 
 // Sets default values for this component's properties
 UGSCCoreComponent::UGSCCoreComponent()
@@ -18,6 +22,14 @@ UGSCCoreComponent::UGSCCoreComponent()
 	// off to improve performance if you don't need them.
 	PrimaryComponentTick.bCanEverTick = false;
 	SetIsReplicatedByDefault(true);
+
+	const UClass* NativeClass = GetClass();
+	while (NativeClass && !NativeClass->HasAnyClassFlags(CLASS_Native))
+	{
+		NativeClass = NativeClass->GetSuperClass();
+	}
+
+	bDispatchPostGameplayEffectExecute = NativeClass != UGSCCoreComponent::StaticClass();
 }
 
 // Called when the game starts
@@ -29,10 +41,24 @@ void UGSCCoreComponent::BeginPlay()
 	SetupOwner();
 }
 
+void UGSCCoreComponent::OnRegister()
+{
+	Super::OnRegister();
+	UGSCComponentRegistrySubsystem::RegisterComponent(this);
+}
+
+void UGSCCoreComponent::OnUnregister()
+{
+	ResetDeferredAttributeChanges();
+	UGSCComponentRegistrySubsystem::UnregisterComponent(this);
+	Super::OnUnregister();
+}
+
 void UGSCCoreComponent::BeginDestroy()
 {
 	// Clean up any bound delegates when component is destroyed
 	ShutdownAbilitySystemDelegates(OwnerAbilitySystemComponent);
+	ResetDeferredAttributeChanges();
 
 	Super::BeginDestroy();
 }
@@ -68,30 +94,77 @@ void UGSCCoreComponent::RegisterAbilitySystemDelegates(UAbilitySystemComponent*
 	// Make sure to shutdown delegates previously registered, if RegisterAbilitySystemDelegates is called more than once (likely from AbilityActorInfo)
 	ShutdownAbilitySystemDelegates(ASC);
 
-	TArray<FGameplayAttribute> Attributes;
-	ASC->GetAllAttributes(Attributes);
+	RegisteredDelegates = GetDelegatesForNetRole();
+	GSC_WLOG(Verbose, TEXT("Delegates profile for net role: %d"), static_cast<int32>(RegisteredDelegates))
 
-	for (FGameplayAttribute Attribute : Attributes)
+	UGSCAbilitySystemComponent* CompanionASC = Cast<UGSCAbilitySystemComponent>(ASC);
+	if (CompanionASC && EnumHasAnyFlags(RegisteredDelegates, EGSCCoreComponentDelegates::Cooldowns))
 	{
-		if (Attribute == UGSCAttributeSet::GetDamageAttribute() || Attribute == UGSCAttributeSet::GetStaminaDamageAttribute())
-		{
-			ASC->GetGameplayAttributeValueChangeDelegate(Attribute).AddUObject(this, &UGSCCoreComponent::OnDamageAttributeChanged);
-		}
-		else
+		// Cooldowns are tracked by the ASC, instead of registering tag events on each commit
+		CompanionASC->GetCooldownTracker().OnCooldownStart.AddUObject(this, &UGSCCoreComponent::OnTrackedCooldownStart);
+		CompanionASC->GetCooldownTracker().OnCooldownEnd.AddUObject(this, &UGSCCoreComponent::OnTrackedCooldownEnd);
+	}
+
+	const bool bRegisterAttributeChanges = EnumHasAnyFlags(RegisteredDelegates, EGSCCoreComponentDelegates::AttributeChanges);
+	if (CompanionASC && bRegisterAttributeChanges)
+	{
+		// Single binding to the ASC attribute change dispatcher, instead of one per attribute
+		CompanionASC->RegisterAttributeChangeDispatcher();
+		CompanionASC->OnAnyAttributeValueChangeDelegate.AddUObject(this, &UGSCCoreComponent::OnAnyAttributeChanged);
+	}
+	else if (bRegisterAttributeChanges)
+	{
+		TArray<FGameplayAttribute> Attributes;
+		ASC->GetAllAttributes(Attributes);
+
+		for (FGameplayAttribute Attribute : Attributes)
 		{
-			ASC->GetGameplayAttributeValueChangeDelegate(Attribute).AddUObject(this, &UGSCCoreComponent::OnAttributeChanged);
+			if (Attribute == UGSCAttributeSet::GetDamageAttribute() || Attribute == UGSCAttributeSet::GetStaminaDamageAttribute())
+			{
+				ASC->GetGameplayAttributeValueChangeDelegate(Attribute).AddUObject(this, &UGSCCoreComponent::OnDamageAttributeChanged);
+			}
+			else
+			{
+				ASC->GetGameplayAttributeValueChangeDelegate(Attribute).AddUObject(this, &UGSCCoreComponent::OnAttributeChanged);
+			}
 		}
 	}
 
 	// Handle GameplayEffects added / remove
-	ASC->OnActiveGameplayEffectAddedDelegateToSelf.AddUObject(this, &UGSCCoreComponent::OnActiveGameplayEffectAdded);
-	ASC->OnAnyGameplayEffectRemovedDelegate().AddUObject(this, &UGSCCoreComponent::OnAnyGameplayEffectRemoved);
+	if (EnumHasAnyFlags(RegisteredDelegates, EGSCCoreComponentDelegates::GameplayEffects | EGSCCoreComponentDelegates::GameplayEffectTimes))
+	{
+		ASC->OnActiveGameplayEffectAddedDelegateToSelf.AddUObject(this, &UGSCCoreComponent::OnActiveGameplayEffectAdded);
+		ASC->OnAnyGameplayEffectRemovedDelegate().AddUObject(this, &UGSCCoreComponent::OnAnyGameplayEffectRemoved);
+	}
 
 	// Handle generic GameplayTags added / removed
-	ASC->RegisterGenericGameplayTagEvent().AddUObject(this, &UGSCCoreComponent::OnAnyGameplayTagChanged);
+	if (bBroadcastGameplayTagChanges && EnumHasAnyFlags(RegisteredDelegates, EGSCCoreComponentDelegates::GameplayTags))
+	{
+		ASC->RegisterGenericGameplayTagEvent().AddUObject(this, &UGSCCoreComponent::OnAnyGameplayTagChanged);
+	}
 
-	// Handle Ability Commit events
-	ASC->AbilityCommittedCallbacks.AddUObject(this, &UGSCCoreComponent::OnAbilityCommitted);
+	// Handle Ability Commit events (also used for cooldowns when ASC is not a GSC ASC)
+	const bool bNeedsCommitsForCooldowns = !CompanionASC && EnumHasAnyFlags(RegisteredDelegates, EGSCCoreComponentDelegates::Cooldowns);
+	if (bNeedsCommitsForCooldowns || EnumHasAnyFlags(RegisteredDelegates, EGSCCoreComponentDelegates::AbilityCommits))
+	{
+		ASC->AbilityCommittedCallbacks.AddUObject(this, &UGSCCoreComponent::OnAbilityCommitted);
+	}
+}
+
+EGSCCoreComponentDelegates UGSCCoreComponent::GetDelegatesForNetRole() const
+{
+	if (GetNetMode() == NM_DedicatedServer)
+	{
+		return static_cast<EGSCCoreComponentDelegates>(DedicatedServerDelegates);
+	}
+
+	const AActor* Owner = GetOwner();
+	if (Owner && Owner->GetLocalRole() == ROLE_SimulatedProxy)
+	{
+		return static_cast<EGSCCoreComponentDelegates>(SimulatedProxyDelegates);
+	}
+
+	return EGSCCoreComponentDelegates::All;
 }
 
 void UGSCCoreComponent::ShutdownAbilitySystemDelegates(UAbilitySystemComponent* ASC)
@@ -100,15 +173,26 @@ void UGSCCoreComponent::ShutdownAbilitySystemDelegates(UAbilitySystemComponent*
 
 	if (!ASC)
 	{
+		DEC_DWORD_STAT_BY(STAT_GSC_CoreComponentEffectHandles, GameplayEffectAddedHandles.Num());
+		GameplayEffectAddedHandles.Reset();
 		return;
 	}
 
-	TArray<FGameplayAttribute> Attributes;
-	ASC->GetAllAttributes(Attributes);
-
-	for (const FGameplayAttribute& Attribute : Attributes)
+	if (UGSCAbilitySystemComponent* CompanionASC = Cast<UGSCAbilitySystemComponent>(ASC))
 	{
-		ASC->GetGameplayAttributeValueChangeDelegate(Attribute).RemoveAll(this);
+		CompanionASC->OnAnyAttributeValueChangeDelegate.RemoveAll(this);
+		CompanionASC->GetCooldownTracker().OnCooldownStart.RemoveAll(this);
+		CompanionASC->GetCooldownTracker().OnCooldownEnd.RemoveAll(this);
+	}
+	else
+	{
+		TArray<FGameplayAttribute> Attributes;
+		ASC->GetAllAttributes(Attributes);
+
+		for (const FGameplayAttribute& Attribute : Attributes)
+		{
+			ASC->GetGameplayAttributeValueChangeDelegate(Attribute).RemoveAll(this);
+		}
 	}
 
 	ASC->OnActiveGameplayEffectAddedDelegateToSelf.RemoveAll(this);
@@ -134,6 +218,9 @@ void UGSCCoreComponent::ShutdownAbilitySystemDelegates(UAbilitySystemComponent*
 		}
 	}
 
+	DEC_DWORD_STAT_BY(STAT_GSC_CoreComponentEffectHandles, GameplayEffectAddedHandles.Num());
+	GameplayEffectAddedHandles.Reset();
+
 	for (const FGameplayTag GameplayTagBoundToDelegate : GameplayTagBoundToDelegates)
 	{
 		ASC->RegisterGameplayTagEvent(GameplayTagBoundToDelegate).RemoveAll(this);
@@ -191,6 +278,18 @@ void UGSCCoreComponent::HandleAttributeChange(const FGameplayAttribute Attribute
 	OnAttributeChange.Broadcast(Attribute, DeltaValue, EventTags);
 }
 
+void UGSCCoreComponent::OnAnyAttributeChanged(const FOnAttributeChangeData& Data)
+{
+	if (Data.Attribute == UGSCAttributeSet::GetDamageAttribute() || Data.Attribute == UGSCAttributeSet::GetStaminaDamageAttribute())
+	{
+		OnDamageAttributeChanged(Data);
+	}
+	else
+	{
+		OnAttributeChanged(Data);
+	}
+}
+
 void UGSCCoreComponent::OnAttributeChanged(const FOnAttributeChangeData& Data)
 {
 	const float NewValue = Data.NewValue;
@@ -204,16 +303,67 @@ void UGSCCoreComponent::OnAttributeChanged(const FOnAttributeChangeData& Data)
 	}
 
 	const FGameplayEffectModCallbackData* ModData = Data.GEModData;
-	FGameplayTagContainer SourceTags = FGameplayTagContainer();
-	if (ModData)
+	const FGameplayTagContainer& SourceTags = ModData ? *ModData->EffectSpec.CapturedSourceTags.GetAggregatedTags() : FGameplayTagContainer::EmptyContainer;
+
+	if (bDeferAttributeChangeBroadcasts && !SynchronousAttributes.Contains(Data.Attribute))
 	{
-		SourceTags = *ModData->EffectSpec.CapturedSourceTags.GetAggregatedTags();
+		DeferAttributeChange(Data.Attribute, NewValue - OldValue, SourceTags);
+		return;
 	}
 
 	// Broadcast attribute change to component
 	OnAttributeChange.Broadcast(Data.Attribute, NewValue - OldValue, SourceTags);
 }
 
+void UGSCCoreComponent::FlushDeferredAttributeChanges()
+{
+	// Move pending changes out first, listeners may change attributes again while we broadcast
+	TArray<FGSCDeferredAttributeChange, TInlineAllocator<4>> Changes = MoveTemp(DeferredAttributeChanges);
+	ResetDeferredAttributeChanges();
+
+	for (const FGSCDeferredAttributeChange& Change : Changes)
+	{
+		// Changes cancelling each other out during the frame are dropped, same as a change with equal old and new values
+		if (Change.DeltaValue != 0.f)
+		{
+			OnAttributeChange.Broadcast(Change.Attribute, Change.DeltaValue, Change.SourceTags);
+		}
+	}
+}
+
+void UGSCCoreComponent::DeferAttributeChange(const FGameplayAttribute& Attribute, const float DeltaValue, const FGameplayTagContainer& SourceTags)
+{
+	FGSCDeferredAttributeChange* Change = DeferredAttributeChanges.FindByPredicate([&Attribute](const FGSCDeferredAttributeChange& Pending)
+	{
+		return Pending.Attribute == Attribute;
+	});
+
+	if (!Change)
+	{
+		Change = &DeferredAttributeChanges.AddDefaulted_GetRef();
+		Change->Attribute = Attribute;
+	}
+
+	Change->DeltaValue += DeltaValue;
+	Change->SourceTags.AppendTags(SourceTags);
+
+	if (!DeferredAttributeChangesHandle.IsValid())
+	{
+		DeferredAttributeChangesHandle = FCoreDelegates::OnEndFrame.AddUObject(this, &UGSCCoreComponent::FlushDeferredAttributeChanges);
+	}
+}
+
+void UGSCCoreComponent::ResetDeferredAttributeChanges()
+{
+	DeferredAttributeChanges.Reset();
+
+	if (DeferredAttributeChangesHandle.IsValid())
+	{
+		FCoreDelegates::OnEndFrame.Remove(DeferredAttributeChangesHandle);
+		DeferredAttributeChangesHandle.Reset();
+	}
+}
+
 void UGSCCoreComponent::OnDamageAttributeChanged(const FOnAttributeChangeData& Data)
 {
 	// if we ever need to broadcast via delegate
@@ -406,7 +556,12 @@ bool UGSCCoreComponent::IsUsingAbilityByClass(const TSubclassOf<UGameplayAbility
 		return false;
 	}
 
-	return GetActiveAbilitiesByClass(AbilityClass).Num() > 0;
+	if (const UGSCAbilitySystemComponent* CompanionASC = Cast<UGSCAbilitySystemComponent>(OwnerAbilitySystemComponent))
+	{
+		return CompanionASC->HasActiveAbilityOfClass(AbilityClass);
+	}
+
+	return GetFirstActiveAbilityByClass(AbilityClass) != nullptr;
 }
 
 bool UGSCCoreComponent::IsUsingAbilityByTags(const FGameplayTagContainer AbilityTags)
@@ -428,35 +583,52 @@ TArray<UGameplayAbility*> UGSCCoreComponent::GetActiveAbilitiesByClass(TSubclass
 		return {};
 	}
 
-	TArray<FGameplayAbilitySpec> Specs = OwnerAbilitySystemComponent->GetActivatableAbilities();
-	TArray<struct FGameplayAbilitySpec*> MatchingGameplayAbilities;
 	TArray<UGameplayAbility*> ActiveAbilities;
+	ForEachActiveAbilityOfClass(AbilityToSearch, [&ActiveAbilities](UGameplayAbility* ActiveAbility)
+	{
+		ActiveAbilities.Add(ActiveAbility);
+		return true;
+	});
 
-	// First, search for matching Abilities for this class
-	for (const FGameplayAbilitySpec& Spec : Specs)
+	return ActiveAbilities;
+}
+
+void UGSCCoreComponent::ForEachActiveAbilityOfClass(const TSubclassOf<UGameplayAbility> AbilityToSearch, const TFunctionRef<bool(UGameplayAbility*)> Visitor) const
+{
+	if (!OwnerAbilitySystemComponent || !AbilityToSearch)
 	{
-		if (Spec.Ability && Spec.Ability->GetClass()->IsChildOf(AbilityToSearch))
-		{
-			MatchingGameplayAbilities.Add(const_cast<FGameplayAbilitySpec*>(&Spec));
-		}
+		return;
 	}
 
-	// Iterate the list of all ability specs
-	for (const FGameplayAbilitySpec* Spec : MatchingGameplayAbilities)
+	// Go through the ASC class index when we can
+	if (const UGSCAbilitySystemComponent* CompanionASC = Cast<UGSCAbilitySystemComponent>(OwnerAbilitySystemComponent))
 	{
-		// Iterate all instances on this ability spec, which can include instance per execution abilities
-		TArray<UGameplayAbility*> AbilityInstances = Spec->GetAbilityInstances();
+		CompanionASC->ForEachActiveAbilityOfClass(AbilityToSearch, Visitor);
+		return;
+	}
 
-		for (UGameplayAbility* ActiveAbility : AbilityInstances)
+	for (const FGameplayAbilitySpec& Spec : OwnerAbilitySystemComponent->GetActivatableAbilities())
+	{
+		if (Spec.Ability && Spec.Ability->GetClass()->IsChildOf(AbilityToSearch))
 		{
-			if (ActiveAbility->IsActive())
+			if (!FGSCAbilitySpecIndex::ForEachActiveAbilityInstance(Spec, Visitor))
 			{
-				ActiveAbilities.Add(ActiveAbility);
+				return;
 			}
 		}
 	}
+}
 
-	return ActiveAbilities;
+UGameplayAbility* UGSCCoreComponent::GetFirstActiveAbilityByClass(const TSubclassOf<UGameplayAbility> AbilityToSearch) const
+{
+	UGameplayAbility* FoundAbility = nullptr;
+	ForEachActiveAbilityOfClass(AbilityToSearch, [&FoundAbility](UGameplayAbility* ActiveAbility)
+	{
+		FoundAbility = ActiveAbility;
+		return false;
+	});
+
+	return FoundAbility;
 }
 
 TArray<UGameplayAbility*> UGSCCoreComponent::GetActiveAbilitiesByTags(const FGameplayTagContainer GameplayTagContainer) const
@@ -498,15 +670,15 @@ bool UGSCCoreComponent::ActivateAbilityByClass(const TSubclassOf<UGameplayAbilit
 
 	const bool bSuccess = OwnerAbilitySystemComponent->TryActivateAbilityByClass(AbilityClass, bAllowRemoteActivation);
 
-	TArray<UGameplayAbility*> ActiveAbilities = GetActiveAbilitiesByClass(AbilityClass);
-	if (ActiveAbilities.Num() == 0)
+	UGameplayAbility* ActiveAbility = GetFirstActiveAbilityByClass(AbilityClass);
+	if (!ActiveAbility)
 	{
 		GSC_LOG(Verbose, TEXT("UGSCCoreComponent::ActivateAbilityByClass Couldn't get back active abilities with Class %s. Won't be able to return ActivatedAbility instance."), *AbilityClass->GetName());
 	}
 
-	if (bSuccess && ActiveAbilities.Num() > 0)
+	if (bSuccess && ActiveAbility)
 	{
-		UGSCGameplayAbility* GSCAbility = Cast<UGSCGameplayAbility>(ActiveAbilities[0]);
+		UGSCGameplayAbility* GSCAbility = Cast<UGSCGameplayAbility>(ActiveAbility);
 		if (GSCAbility)
 		{
 			ActivatedAbility = GSCAbility;
@@ -605,39 +777,42 @@ void UGSCCoreComponent::PreAttributeChange(UGSCAttributeSetBase* AttributeSet, c
 	OnPreAttributeChange.Broadcast(AttributeSet, Attribute, NewValue);
 }
 
-void UGSCCoreComponent::PostGameplayEffectExecute(UGSCAttributeSetBase* AttributeSet, const FGameplayEffectModCallbackData& Data)
+void UGSCCoreComponent::PostGameplayEffectExecuteWithContext(UGSCAttributeSetBase* AttributeSet, const FGSCAttributeSetExecutionContext& ExecutionContext)
 {
-	if (!AttributeSet)
+	// Compatibility path for native subclasses overriding PostGameplayEffectExecute
+	if (bDispatchPostGameplayEffectExecute)
 	{
-		GSC_LOG(Error, TEXT("UGSCCoreComponent:PostGameplayEffectExecute() Owner AttributeSet isn't valid"));
+		PostGameplayEffectExecute(AttributeSet, ExecutionContext.GetModCallbackData());
 		return;
 	}
 
-	AActor* SourceActor = nullptr;
-	AActor* TargetActor = nullptr;
-	AttributeSet->GetSourceAndTargetFromContext<AActor>(Data, SourceActor, TargetActor);
-
-	const FGameplayTagContainer SourceTags = AttributeSet->GetSourceTagsFromContext(Data);
-	const FGameplayEffectContextHandle Context = Data.EffectSpec.GetContext();
+	BroadcastPostGameplayEffectExecute(AttributeSet, ExecutionContext);
+}
 
-	// Get Minimum Clamp value for this attribute, if it is available
-	const float ClampMinimumValue = AttributeSet->GetClampMinimumValueFor(Data.EvaluatedData.Attribute);
+void UGSCCoreComponent::PostGameplayEffectExecute(UGSCAttributeSetBase* AttributeSet, const FGameplayEffectModCallbackData& Data)
+{
+	const FGSCAttributeSetExecutionContext ExecutionContext(Data);
+	BroadcastPostGameplayEffectExecute(AttributeSet, ExecutionContext);
+}
 
-	// Compute the delta between old and new, if it is available
-	float DeltaValue = 0;
-	if (Data.EvaluatedData.ModifierOp == EGameplayModOp::Type::Additive)
+void UGSCCoreComponent::BroadcastPostGameplayEffectExecute(UGSCAttributeSetBase* AttributeSet, const FGSCAttributeSetExecutionContext& ExecutionContext) const
+{
+	if (!AttributeSet)
 	{
-		// If this was additive, store the raw delta value to be passed along later
-		DeltaValue = Data.EvaluatedData.Magnitude;
+		GSC_LOG(Error, TEXT("UGSCCoreComponent:PostGameplayEffectExecute() Owner AttributeSet isn't valid"));
+		return;
 	}
 
+	const FGameplayEffectModCallbackData& Data = ExecutionContext.GetModCallbackData();
+
 	// Delegate any attribute handling to Blueprints
 	FGSCGameplayEffectExecuteData Payload;
 	Payload.AttributeSet = AttributeSet;
 	Payload.AbilitySystemComponent = AttributeSet->GetOwningAbilitySystemComponent();
-	Payload.DeltaValue = DeltaValue;
-	Payload.ClampMinimumValue = ClampMinimumValue;
-	OnPostGameplayEffectExecute.Broadcast(Data.EvaluatedData.Attribute, SourceActor, TargetActor, SourceTags, Payload);
+	Payload.DeltaValue = ExecutionContext.GetDeltaValue();
+	// Get Minimum Clamp value for this attribute, if it is available
+	Payload.ClampMinimumValue = AttributeSet->GetClampMinimumValueFor(Data.EvaluatedData.Attribute);
+	OnPostGameplayEffectExecute.Broadcast(Data.EvaluatedData.Attribute, ExecutionContext.GetSourceActor(), ExecutionContext.GetTargetActor(), ExecutionContext.GetSourceTags(), Payload);
 }
 
 void UGSCCoreComponent::SetStartupAbilitiesGranted(const bool bGranted)
@@ -658,13 +833,30 @@ void UGSCCoreComponent::OnActiveGameplayEffectAdded(UAbilitySystemComponent* Tar
 	FGameplayTagContainer GrantedTags;
 	SpecApplied.GetAllGrantedTags(GrantedTags);
 
-	OnGameplayEffectAdded.Broadcast(AssetTags, GrantedTags, ActiveHandle);
+	// Effects not subscribed to are never tracked, and their stack / time / removal events are ignored
+	if (bFilterGameplayEffectEvents && !MatchesGameplayEffectEventQueries(AssetTags, GrantedTags))
+	{
+		return;
+	}
 
-	OwnerAbilitySystemComponent->OnGameplayEffectStackChangeDelegate(ActiveHandle)->AddUObject(this, &UGSCCoreComponent::OnActiveGameplayEffectStackChanged);
-	OwnerAbilitySystemComponent->OnGameplayEffectTimeChangeDelegate(ActiveHandle)->AddUObject(this, &UGSCCoreComponent::OnActiveGameplayEffectTimeChanged);
+	if (EnumHasAnyFlags(RegisteredDelegates, EGSCCoreComponentDelegates::GameplayEffects))
+	{
+		OnGameplayEffectAdded.Broadcast(AssetTags, GrantedTags, ActiveHandle);
+		OwnerAbilitySystemComponent->OnGameplayEffectStackChangeDelegate(ActiveHandle)->AddUObject(this, &UGSCCoreComponent::OnActiveGameplayEffectStackChanged);
+	}
+
+	if (EnumHasAnyFlags(RegisteredDelegates, EGSCCoreComponentDelegates::GameplayEffectTimes))
+	{
+		OwnerAbilitySystemComponent->OnGameplayEffectTimeChangeDelegate(ActiveHandle)->AddUObject(this, &UGSCCoreComponent::OnActiveGameplayEffectTimeChanged);
+	}
 
 	// Store active handles to clear out bound delegates when shutting down listeners
-	GameplayEffectAddedHandles.AddUnique(ActiveHandle);
+	bool bAlreadyTracked = false;
+	GameplayEffectAddedHandles.Add(ActiveHandle, &bAlreadyTracked);
+	if (!bAlreadyTracked)
+	{
+		INC_DWORD_STAT(STAT_GSC_CoreComponentEffectHandles);
+	}
 }
 
 void UGSCCoreComponent::OnActiveGameplayEffectStackChanged(const FActiveGameplayEffectHandle ActiveHandle, const int32 NewStackCount, const int32 PreviousStackCount)
@@ -718,6 +910,23 @@ void UGSCCoreComponent::OnAnyGameplayEffectRemoved(const FActiveGameplayEffect&
 		return;
 	}
 
+	// Delegates bound to this handle go away with the effect, no need to keep track of it anymore
+	const bool bWasTracked = GameplayEffectAddedHandles.Remove(EffectRemoved.Handle) > 0;
+	if (bWasTracked)
+	{
+		DEC_DWORD_STAT(STAT_GSC_CoreComponentEffectHandles);
+	}
+	else if (bFilterGameplayEffectEvents)
+	{
+		// Not subscribed to when it was added
+		return;
+	}
+
+	if (!EnumHasAnyFlags(RegisteredDelegates, EGSCCoreComponentDelegates::GameplayEffects))
+	{
+		return;
+	}
+
 	FGameplayTagContainer AssetTags;
 	EffectRemoved.Spec.GetAllAssetTags(AssetTags);
 
@@ -728,9 +937,59 @@ void UGSCCoreComponent::OnAnyGameplayEffectRemoved(const FActiveGameplayEffect&
 	OnGameplayEffectRemoved.Broadcast(AssetTags, GrantedTags, EffectRemoved.Handle);
 }
 
+int32 UGSCCoreComponent::SubscribeToGameplayEffectEvents(const FGameplayTagQuery& Query)
+{
+	const int32 SubscriptionHandle = ++LastGameplayEffectEventSubscription;
+	GameplayEffectEventSubscriptions.Add(SubscriptionHandle, Query);
+	return SubscriptionHandle;
+}
+
+void UGSCCoreComponent::UnsubscribeFromGameplayEffectEvents(const int32 SubscriptionHandle)
+{
+	GameplayEffectEventSubscriptions.Remove(SubscriptionHandle);
+}
+
+bool UGSCCoreComponent::MatchesGameplayEffectEventQueries(const FGameplayTagContainer& AssetTags, const FGameplayTagContainer& GrantedTags) const
+{
+	if (GameplayEffectEventQueries.IsEmpty() && GameplayEffectEventSubscriptions.IsEmpty())
+	{
+		return false;
+	}
+
+	FGameplayTagContainer EffectTags = AssetTags;
+	EffectTags.AppendTags(GrantedTags);
+
+	for (const FGameplayTagQuery& Query : GameplayEffectEventQueries)
+	{
+		if (Query.Matches(EffectTags))
+		{
+			return true;
+		}
+	}
+
+	for (const TPair<int32, FGameplayTagQuery>& Subscription : GameplayEffectEventSubscriptions)
+	{
+		if (Subscription.Value.Matches(EffectTags))
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+void UGSCCoreComponent::SetGameplayTagChangeFilter(const FGSCGameplayTagChangeFilter& InFilter)
+{
+	GameplayTagChangeFilter = InFilter;
+	GameplayTagChangeFilter.ResetCache();
+}
+
 void UGSCCoreComponent::OnAnyGameplayTagChanged(const FGameplayTag GameplayTag, const int32 NewCount) const
 {
-	OnGameplayTagChange.Broadcast(GameplayTag, NewCount);
+	if (GameplayTagChangeFilter.Matches(GameplayTag))
+	{
+		OnGameplayTagChange.Broadcast(GameplayTag, NewCount);
+	}
 }
 
 void UGSCCoreComponent::OnAbilityCommitted(UGameplayAbility* ActivatedAbility)
@@ -741,9 +1000,26 @@ void UGSCCoreComponent::OnAbilityCommitted(UGameplayAbility* ActivatedAbility)
 	}
 
 	// Trigger AbilityCommit event
-	OnAbilityCommit.Broadcast(ActivatedAbility);
+	if (EnumHasAnyFlags(RegisteredDelegates, EGSCCoreComponentDelegates::AbilityCommits))
+	{
+		OnAbilityCommit.Broadcast(ActivatedAbility);
+	}
 
-	HandleCooldownOnAbilityCommit(ActivatedAbility);
+	// GSC Ability System Components track cooldowns themselves, see OnTrackedCooldownStart / OnTrackedCooldownEnd
+	if (!Cast<UGSCAbilitySystemComponent>(OwnerAbilitySystemComponent) && EnumHasAnyFlags(RegisteredDelegates, EGSCCoreComponentDelegates::Cooldowns))
+	{
+		HandleCooldownOnAbilityCommit(ActivatedAbility);
+	}
+}
+
+void UGSCCoreComponent::OnTrackedCooldownStart(UGameplayAbility* Ability, const FGameplayTagContainer& CooldownTags, const float TimeRemaining, const float Duration)
+{
+	OnCooldownStart.Broadcast(Ability, CooldownTags, TimeRemaining, Duration);
+}
+
+void UGSCCoreComponent::OnTrackedCooldownEnd(UGameplayAbility* Ability, const FGameplayTag& CooldownTag, const float Duration)
+{
+	OnCooldownEnd.Broadcast(Ability, CooldownTag, Duration);
 }
 
 void UGSCCoreComponent::OnCooldownGameplayTagChanged(const FGameplayTag GameplayTag, const int32 NewCount, const FGameplayAbilitySpecHandle AbilitySpecHandle, const float Duration)
@@ -0,0 +1,9 @@
+// Copyright 2021 Mickael Daniel. All Rights Reserved.
+
+
+#include "GSCStats.h"
+
+DEFINE_STAT(STAT_GSC_AttributeSetsAllocated);
+DEFINE_STAT(STAT_GSC_AttributeSetsReused);
+DEFINE_STAT(STAT_GSC_CoreComponentEffectHandles);
+DEFINE_STAT(STAT_GSC_UserWidgetEffectHandles);
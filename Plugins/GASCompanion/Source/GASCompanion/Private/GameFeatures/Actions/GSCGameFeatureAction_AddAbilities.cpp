@@ -5,6 +5,7 @@
 #include "AbilitySystemComponent.h"
 #include "AbilitySystemGlobals.h"
 #include "GSCLog.h"
+#include "Abilities/GSCBlueprintFunctionLibrary.h"
 #include "GameFeaturesSubsystemSettings.h"
 #include "Abilities/GSCAbilitySystemComponent.h"
 #include "Abilities/GSCAbilitySystemUtils.h"
@@ -225,11 +226,18 @@ void UGSCGameFeatureAction_AddAbilities::AddActorAbilities(AActor* Actor, const
 	
 	GSC_LOG(Display, TEXT("Trying to add actor abilities from Game Feature action for Owner: %s, Avatar: %s, Original Actor: %s"), *GetNameSafe(OwnerActor), *GetNameSafe(AvatarActor), *GetNameSafe(Actor));
 
+	// Attribute sets from the previous spawn, reset in place when granted again instead of being reallocated
+	TArray<UAttributeSet*> PooledAttributes;
+
 	// Handle cleaning up of previous attributes / abilities in case of respawns
 	FActorExtensions* ActorExtensions = ActiveExtensions.Find(OwnerActor);
 	if (ActorExtensions)
 	{
-		if (AbilitySystemComponent->bResetAttributesOnSpawn)
+		if (AbilitySystemComponent->bResetAttributesOnSpawn && AbilitySystemComponent->bPoolAttributeSetsOnSpawn)
+		{
+			PooledAttributes = ActorExtensions->Attributes;
+		}
+		else if (AbilitySystemComponent->bResetAttributesOnSpawn)
 		{
 			// ASC wants reset, remove attributes
 			for (UAttributeSet* AttribSetInstance : ActorExtensions->Attributes)
@@ -245,7 +253,7 @@ void UGSCGameFeatureAction_AddAbilities::AddActorAbilities(AActor* Actor, const
 		if (AbilitySystemComponent->bResetAbilitiesOnSpawn)
 		{
 			// ASC wants reset, remove abilities
-			UGSCAbilityInputBindingComponent* InputComponent = AvatarActor ? AvatarActor->FindComponentByClass<UGSCAbilityInputBindingComponent>() : nullptr;
+			UGSCAbilityInputBindingComponent* InputComponent = AvatarActor ? UGSCBlueprintFunctionLibrary::GetAbilityInputBindingComponent(AvatarActor) : nullptr;
 			for (const FGameplayAbilitySpecHandle& AbilityHandle : ActorExtensions->Abilities)
 			{
 				if (InputComponent)
@@ -314,11 +322,26 @@ void UGSCGameFeatureAction_AddAbilities::AddActorAbilities(AActor* Actor, const
 
 			if (AddedAttributeSet)
 			{
+				if (PooledAttributes.Remove(AddedAttributeSet) > 0)
+				{
+					FGSCAbilitySystemUtils::ResetAttributeSet(AddedAttributeSet, Attributes.InitializationData.LoadSynchronous());
+				}
+
 				AddedExtensions.Attributes.Add(AddedAttributeSet);
 			}
 		}
 	}
 
+	// Pooled sets that were not granted again are removed, as they would have been without pooling
+	for (UAttributeSet* AttribSetInstance : PooledAttributes)
+	{
+#if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 1
+		AbilitySystemComponent->RemoveSpawnedAttribute(AttribSetInstance);
+#else
+		AbilitySystemComponent->GetSpawnedAttributes_Mutable().Remove(AttribSetInstance);
+#endif
+	}
+
 	for (const FGSCGameFeatureGameplayEffectMapping& Effect : AbilitiesEntry.GrantedEffects)
 	{
 		if (!Effect.EffectType.IsNull())
@@ -345,7 +368,7 @@ void UGSCGameFeatureAction_AddAbilities::AddActorAbilities(AActor* Actor, const
 	}
 
 	// GSCCore component could be added to avatars
-	UGSCCoreComponent* CoreComponent = AvatarActor ? AvatarActor->FindComponentByClass<UGSCCoreComponent>() : nullptr;
+	UGSCCoreComponent* CoreComponent = AvatarActor ? UGSCBlueprintFunctionLibrary::GetCompanionCoreComponent(AvatarActor) : nullptr;
 	if (CoreComponent)
 	{
 		// Make sure to notify we may have added attributes
@@ -384,7 +407,7 @@ void UGSCGameFeatureAction_AddAbilities::RemoveActorAbilities(const AActor* Acto
 			}
 
 			// Remove abilities
-			UGSCAbilityInputBindingComponent* InputComponent = Actor->FindComponentByClass<UGSCAbilityInputBindingComponent>();
+			UGSCAbilityInputBindingComponent* InputComponent = UGSCBlueprintFunctionLibrary::GetAbilityInputBindingComponent(Actor);
 			for (const FGameplayAbilitySpecHandle& AbilityHandle : ActorExtensions->Abilities)
 			{
 				if (InputComponent)
@@ -0,0 +1,93 @@
+// Copyright 2021 Mickael Daniel. All Rights Reserved.
+
+#include "Subsystems/GSCComponentRegistrySubsystem.h"
+
+#include "Components/ActorComponent.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+
+void UGSCComponentRegistrySubsystem::Deinitialize()
+{
+	RegisteredComponents.Reset();
+	Super::Deinitialize();
+}
+
+void UGSCComponentRegistrySubsystem::RegisterComponent(UActorComponent* InComponent)
+{
+	UGSCComponentRegistrySubsystem* Registry = GetRegistryForComponent(InComponent);
+	if (!Registry)
+	{
+		return;
+	}
+
+	FGSCRegisteredComponents& Components = Registry->RegisteredComponents.FindOrAdd(TObjectKey<AActor>(InComponent->GetOwner()));
+	Components.AddUnique(InComponent);
+}
+
+void UGSCComponentRegistrySubsystem::UnregisterComponent(UActorComponent* InComponent)
+{
+	UGSCComponentRegistrySubsystem* Registry = GetRegistryForComponent(InComponent);
+	if (!Registry)
+	{
+		return;
+	}
+
+	const TObjectKey<AActor> OwnerKey(InComponent->GetOwner());
+	FGSCRegisteredComponents* Components = Registry->RegisteredComponents.Find(OwnerKey);
+	if (!Components)
+	{
+		return;
+	}
+
+	// Also drop any stale entries while we're here
+	Components->RemoveAllSwap([InComponent](const TWeakObjectPtr<UActorComponent>& Component)
+	{
+		return !Component.IsValid() || Component.Get() == InComponent;
+	});
+
+	if (Components->IsEmpty())
+	{
+		Registry->RegisteredComponents.Remove(OwnerKey);
+	}
+}
+
+UActorComponent* UGSCComponentRegistrySubsystem::FindComponentForActor(const AActor* InActor, const TSubclassOf<UActorComponent> InComponentClass)
+{
+	if (!IsValid(InActor) || !InComponentClass)
+	{
+		return nullptr;
+	}
+
+	const UWorld* World = InActor->GetWorld();
+	const UGSCComponentRegistrySubsystem* Registry = World ? World->GetSubsystem<UGSCComponentRegistrySubsystem>() : nullptr;
+	if (!Registry)
+	{
+		return InActor->FindComponentByClass(InComponentClass);
+	}
+
+	if (const FGSCRegisteredComponents* Components = Registry->RegisteredComponents.Find(TObjectKey<AActor>(InActor)))
+	{
+		for (const TWeakObjectPtr<UActorComponent>& WeakComponent : *Components)
+		{
+			UActorComponent* Component = WeakComponent.Get();
+			if (Component && Component->IsA(InComponentClass))
+			{
+				return Component;
+			}
+		}
+	}
+
+	// Not registered (yet), fall back to a component search to better support BP-only actors and unregistered components
+	return InActor->FindComponentByClass(InComponentClass);
+}
+
+UGSCComponentRegistrySubsystem* UGSCComponentRegistrySubsystem::GetRegistryForComponent(const UActorComponent* InComponent)
+{
+	if (!InComponent || !InComponent->GetOwner())
+	{
+		return nullptr;
+	}
+
+	const UWorld* World = InComponent->GetWorld();
+	return World ? World->GetSubsystem<UGSCComponentRegistrySubsystem>() : nullptr;
+}
@@ -3,6 +3,7 @@
 #include "Subsystems/GSCConsoleManagerSubsystem.h"
 
 #include "GSCLog.h"
+#include "Abilities/GSCBlueprintFunctionLibrary.h"
 #include "Components/GSCAbilityQueueComponent.h"
 #include "Components/GSCComboManagerComponent.h"
 #include "GameFramework/Pawn.h"
@@ -123,7 +124,7 @@ void UGSCConsoleManagerSubsystem::ToggleComboDebugWidgetWithPC(APlayerController
 
 	if (const APawn* Pawn = PC->GetPawn())
 	{
-		const UGSCComboManagerComponent* Component = Pawn->FindComponentByClass<UGSCComboManagerComponent>();
+		const UGSCComboManagerComponent* Component = UGSCBlueprintFunctionLibrary::GetComboManagerComponent(Pawn);
 		if (!Component)
 		{
 			GSC_SLOG(Error, TEXT("UGSCConsoleManagerSubsystem:ToggleComboDebugWidget() Pawn %s doesn't have an ComboManagerComponent.\nMake sure to add it in Blueprint to your Pawn."), *Pawn->GetName())
@@ -166,7 +167,7 @@ void UGSCConsoleManagerSubsystem::ToggleAbilityQueueWidgetWithPC(APlayerControll
 
 	if (const APawn* Pawn = PC->GetPawn())
 	{
-		const UGSCAbilityQueueComponent* Component = Pawn->FindComponentByClass<UGSCAbilityQueueComponent>();
+		const UGSCAbilityQueueComponent* Component = UGSCBlueprintFunctionLibrary::GetAbilityQueueComponent(Pawn);
 		if (!Component)
 		{
 			GSC_SLOG(Error, TEXT("UGSCConsoleManagerSubsystem:ToggleAbilityQueueDebugWidget() Pawn %s doesn't have an AbilityQueueComponent.\nMake sure to add it in Blueprint to your Pawn."), *Pawn->GetName())
@@ -39,18 +39,19 @@ void UGSCUWHud::NativeTick(const FGeometry& MyGeometry, float InDeltaTime)
 	Super::NativeTick(MyGeometry, InDeltaTime);
 
 	// Lazy init disabled, was either good from native construct or initialized once here
-	if (!bLazyAbilitySystemInitialization)
-	{
-		return;
-	}
-
-	if (TryInitAbilitySystem())
+	if (bLazyAbilitySystemInitialization && TryInitAbilitySystem())
 	{
 		// We now have proper ASC and initialized widget, prevent further tick run
 		bLazyAbilitySystemInitialization = false;
 		
 		GSC_LOG(Warning, TEXT("UGSCUWHud::NativeTick reconciliated with ASC. We now have a reference to it: %s (%s)"), *GetNameSafe(AbilitySystemComponent), *GetNameSafe(OwnerActor))
 	}
+
+	TimeSinceAttributeRefresh = FMath::Min(TimeSinceAttributeRefresh + InDeltaTime, AttributeRefreshInterval);
+	if (bAttributeWidgetsDirty && TimeSinceAttributeRefresh >= AttributeRefreshInterval)
+	{
+		RefreshAttributeWidgets();
+	}
 }
 
 void UGSCUWHud::InitFromCharacter()
@@ -61,6 +62,12 @@ void UGSCUWHud::InitFromCharacter()
 		return;
 	}
 
+	// Start over from the ASC values, and rebuild texts regardless of what they currently display
+	HealthDisplay = FAttributeDisplay();
+	StaminaDisplay = FAttributeDisplay();
+	ManaDisplay = FAttributeDisplay();
+	bAttributeWidgetsDirty = false;
+
 	SetHealth(GetAttributeValue(UGSCAttributeSet::GetHealthAttribute()));
 	SetStamina(GetAttributeValue(UGSCAttributeSet::GetStaminaAttribute()));
 	SetMana(GetAttributeValue(UGSCAttributeSet::GetManaAttribute()));
@@ -68,11 +75,9 @@ void UGSCUWHud::InitFromCharacter()
 
 void UGSCUWHud::SetMaxHealth(const float MaxHealth)
 {
-	const float Health = GetAttributeValue(UGSCAttributeSet::GetHealthAttribute());
-	if (HealthText)
-	{
-		HealthText->SetText(FText::FromString(GetAttributeFormatString(Health, MaxHealth)));
-	}
+	HealthDisplay.SetMaxValue(MaxHealth);
+	const float Health = GetDisplayValue(HealthDisplay, UGSCAttributeSet::GetHealthAttribute());
+	UpdateAttributeText(HealthText, HealthDisplay);
 
 	if (MaxHealth != 0)
 	{
@@ -82,11 +87,9 @@ void UGSCUWHud::SetMaxHealth(const float MaxHealth)
 
 void UGSCUWHud::SetHealth(const float Health)
 {
-	const float MaxHealth = GetAttributeValue(UGSCAttributeSet::GetMaxHealthAttribute());
-	if (HealthText)
-	{
-		HealthText->SetText(FText::FromString(GetAttributeFormatString(Health, MaxHealth)));
-	}
+	HealthDisplay.SetValue(Health);
+	const float MaxHealth = GetDisplayMaxValue(HealthDisplay, UGSCAttributeSet::GetMaxHealthAttribute());
+	UpdateAttributeText(HealthText, HealthDisplay);
 
 	if (MaxHealth != 0)
 	{
@@ -96,7 +99,7 @@ void UGSCUWHud::SetHealth(const float Health)
 
 void UGSCUWHud::SetHealthPercentage(const float HealthPercentage)
 {
-	if (HealthProgressBar)
+	if (HealthProgressBar && HealthProgressBar->GetPercent() != HealthPercentage)
 	{
 		HealthProgressBar->SetPercent(HealthPercentage);
 	}
@@ -104,11 +107,9 @@ void UGSCUWHud::SetHealthPercentage(const float HealthPercentage)
 
 void UGSCUWHud::SetMaxStamina(const float MaxStamina)
 {
-	const float Stamina = GetAttributeValue(UGSCAttributeSet::GetStaminaAttribute());
-	if (StaminaText)
-	{
-		StaminaText->SetText(FText::FromString(GetAttributeFormatString(Stamina, MaxStamina)));
-	}
+	StaminaDisplay.SetMaxValue(MaxStamina);
+	const float Stamina = GetDisplayValue(StaminaDisplay, UGSCAttributeSet::GetStaminaAttribute());
+	UpdateAttributeText(StaminaText, StaminaDisplay);
 
 	if (MaxStamina != 0)
 	{
@@ -118,11 +119,9 @@ void UGSCUWHud::SetMaxStamina(const float MaxStamina)
 
 void UGSCUWHud::SetStamina(const float Stamina)
 {
-	const float MaxStamina = GetAttributeValue(UGSCAttributeSet::GetMaxStaminaAttribute());
-	if (StaminaText)
-	{
-		StaminaText->SetText(FText::FromString(GetAttributeFormatString(Stamina, MaxStamina)));
-	}
+	StaminaDisplay.SetValue(Stamina);
+	const float MaxStamina = GetDisplayMaxValue(StaminaDisplay, UGSCAttributeSet::GetMaxStaminaAttribute());
+	UpdateAttributeText(StaminaText, StaminaDisplay);
 
 	if (MaxStamina != 0)
 	{
@@ -132,7 +131,7 @@ void UGSCUWHud::SetStamina(const float Stamina)
 
 void UGSCUWHud::SetStaminaPercentage(const float StaminaPercentage)
 {
-	if (StaminaProgressBar)
+	if (StaminaProgressBar && StaminaProgressBar->GetPercent() != StaminaPercentage)
 	{
 		StaminaProgressBar->SetPercent(StaminaPercentage);
 	}
@@ -140,11 +139,9 @@ void UGSCUWHud::SetStaminaPercentage(const float StaminaPercentage)
 
 void UGSCUWHud::SetMaxMana(const float MaxMana)
 {
-	const float Mana = GetAttributeValue(UGSCAttributeSet::GetManaAttribute());
-	if (ManaText)
-	{
-		ManaText->SetText(FText::FromString(GetAttributeFormatString(Mana, MaxMana)));
-	}
+	ManaDisplay.SetMaxValue(MaxMana);
+	const float Mana = GetDisplayValue(ManaDisplay, UGSCAttributeSet::GetManaAttribute());
+	UpdateAttributeText(ManaText, ManaDisplay);
 
 	if (MaxMana != 0)
 	{
@@ -154,11 +151,9 @@ void UGSCUWHud::SetMaxMana(const float MaxMana)
 
 void UGSCUWHud::SetMana(const float Mana)
 {
-	const float MaxMana = GetAttributeValue(UGSCAttributeSet::GetMaxManaAttribute());
-	if (ManaText)
-	{
-		ManaText->SetText(FText::FromString(GetAttributeFormatString(Mana, MaxMana)));
-	}
+	ManaDisplay.SetValue(Mana);
+	const float MaxMana = GetDisplayMaxValue(ManaDisplay, UGSCAttributeSet::GetMaxManaAttribute());
+	UpdateAttributeText(ManaText, ManaDisplay);
 
 	if (MaxMana != 0)
 	{
@@ -168,7 +163,7 @@ void UGSCUWHud::SetMana(const float Mana)
 
 void UGSCUWHud::SetManaPercentage(const float ManaPercentage)
 {
-	if (ManaProgressBar)
+	if (ManaProgressBar && ManaProgressBar->GetPercent() != ManaPercentage)
 	{
 		ManaProgressBar->SetPercent(ManaPercentage);
 	}
@@ -178,35 +173,139 @@ void UGSCUWHud::HandleAttributeChange(const FGameplayAttribute Attribute, const
 {
 	if (Attribute == UGSCAttributeSet::GetHealthAttribute())
 	{
-		SetHealth(NewValue);
+		MarkAttributeDisplayDirty(HealthDisplay, NewValue, false);
 	}
 	else if (Attribute == UGSCAttributeSet::GetStaminaAttribute())
 	{
-		SetStamina(NewValue);
+		MarkAttributeDisplayDirty(StaminaDisplay, NewValue, false);
 	}
 	else if (Attribute == UGSCAttributeSet::GetManaAttribute())
 	{
-		SetMana(NewValue);
+		MarkAttributeDisplayDirty(ManaDisplay, NewValue, false);
 	}
 	else if (Attribute == UGSCAttributeSet::GetMaxHealthAttribute())
 	{
-		SetMaxHealth(NewValue);
+		MarkAttributeDisplayDirty(HealthDisplay, NewValue, true);
 	}
 	else if (Attribute == UGSCAttributeSet::GetMaxStaminaAttribute())
 	{
-		SetMaxStamina(NewValue);
+		MarkAttributeDisplayDirty(StaminaDisplay, NewValue, true);
 	}
 	else if (Attribute == UGSCAttributeSet::GetMaxManaAttribute())
 	{
-		SetMaxMana(NewValue);
+		MarkAttributeDisplayDirty(ManaDisplay, NewValue, true);
 	}
 }
 
+void UGSCUWHud::RefreshAttributeWidgets()
+{
+	bAttributeWidgetsDirty = false;
+	TimeSinceAttributeRefresh = 0.f;
+
+	// Max value setters go first so that value setters compute the percentage against the new max. Both are called
+	// when both changed, for overrides to see every change (unchanged texts and percents aren't rebuilt anyway)
+	if (HealthDisplay.bMaxValueDirty)
+	{
+		SetMaxHealth(HealthDisplay.MaxValue);
+	}
+
+	if (HealthDisplay.bValueDirty)
+	{
+		SetHealth(HealthDisplay.Value);
+	}
+
+	if (StaminaDisplay.bMaxValueDirty)
+	{
+		SetMaxStamina(StaminaDisplay.MaxValue);
+	}
+
+	if (StaminaDisplay.bValueDirty)
+	{
+		SetStamina(StaminaDisplay.Value);
+	}
+
+	if (ManaDisplay.bMaxValueDirty)
+	{
+		SetMaxMana(ManaDisplay.MaxValue);
+	}
+
+	if (ManaDisplay.bValueDirty)
+	{
+		SetMana(ManaDisplay.Value);
+	}
+
+	HealthDisplay.bValueDirty = false;
+	StaminaDisplay.bValueDirty = false;
+	ManaDisplay.bValueDirty = false;
+	HealthDisplay.bMaxValueDirty = false;
+	StaminaDisplay.bMaxValueDirty = false;
+	ManaDisplay.bMaxValueDirty = false;
+}
+
 FString UGSCUWHud::GetAttributeFormatString(const float BaseValue, const float MaxValue)
 {
 	return FString::Printf(TEXT("%d / %d"), FMath::FloorToInt(BaseValue), FMath::FloorToInt(MaxValue));
 }
 
+float UGSCUWHud::GetDisplayValue(FAttributeDisplay& InDisplay, const FGameplayAttribute& InAttribute) const
+{
+	if (!InDisplay.bHasValue)
+	{
+		InDisplay.SetValue(GetAttributeValue(InAttribute));
+	}
+
+	return InDisplay.Value;
+}
+
+float UGSCUWHud::GetDisplayMaxValue(FAttributeDisplay& InDisplay, const FGameplayAttribute& InMaxAttribute) const
+{
+	if (!InDisplay.bHasMaxValue)
+	{
+		InDisplay.SetMaxValue(GetAttributeValue(InMaxAttribute));
+	}
+
+	return InDisplay.MaxValue;
+}
+
+void UGSCUWHud::UpdateAttributeText(UTextBlock* InTextBlock, FAttributeDisplay& InDisplay)
+{
+	if (!InTextBlock)
+	{
+		return;
+	}
+
+	const int32 TextValue = FMath::FloorToInt(InDisplay.Value);
+	const int32 TextMaxValue = FMath::FloorToInt(InDisplay.MaxValue);
+	if (InDisplay.bHasText && InDisplay.TextValue == TextValue && InDisplay.TextMaxValue == TextMaxValue)
+	{
+		// Same text as the one displayed (regen ticks, fractional changes)
+		return;
+	}
+
+	InTextBlock->SetText(FText::AsCultureInvariant(GetAttributeFormatString(InDisplay.Value, InDisplay.MaxValue)));
+	InDisplay.TextValue = TextValue;
+	InDisplay.TextMaxValue = TextMaxValue;
+	InDisplay.bHasText = true;
+}
+
+void UGSCUWHud::MarkAttributeDisplayDirty(FAttributeDisplay& InDisplay, const float InNewValue, const bool bInMaxValue)
+{
+	if (bInMaxValue)
+	{
+		InDisplay.MaxValue = InNewValue;
+		InDisplay.bHasMaxValue = true;
+		InDisplay.bMaxValueDirty = true;
+	}
+	else
+	{
+		InDisplay.Value = InNewValue;
+		InDisplay.bHasValue = true;
+		InDisplay.bValueDirty = true;
+	}
+
+	bAttributeWidgetsDirty = true;
+}
+
 bool UGSCUWHud::TryInitAbilitySystem()
 {
 	GSC_LOG(Verbose, TEXT("UGSCUWHud::TryInitAbilitySystem check for ASC: %s (%s)"), *GetNameSafe(AbilitySystemComponent), *GetNameSafe(OwnerActor))
@@ -7,8 +7,10 @@
 #include "AbilitySystemComponent.h"
 #include "AbilitySystemGlobals.h"
 #include "GameplayEffectTypes.h"
+#include "Abilities/GSCAbilitySystemComponent.h"
 #include "Abilities/GSCBlueprintFunctionLibrary.h"
 #include "GSCLog.h"
+#include "GSCStats.h"
 
 void UGSCUserWidget::SetOwnerActor(AActor* Actor)
 {
@@ -46,9 +48,22 @@ void UGSCUserWidget::InitializeWithAbilitySystem(const UAbilitySystemComponent*
 void UGSCUserWidget::ResetAbilitySystem()
 {
 	ShutdownAbilitySystemComponentListeners();
+	ResetGameplayEffectAddedHandles();
 	AbilitySystemComponent = nullptr;
 }
 
+void UGSCUserWidget::BeginDestroy()
+{
+	ResetGameplayEffectAddedHandles();
+	Super::BeginDestroy();
+}
+
+void UGSCUserWidget::ResetGameplayEffectAddedHandles()
+{
+	DEC_DWORD_STAT_BY(STAT_GSC_UserWidgetEffectHandles, GameplayEffectAddedHandles.Num());
+	GameplayEffectAddedHandles.Reset();
+}
+
 void UGSCUserWidget::RegisterAbilitySystemDelegates()
 {
 	if (!AbilitySystemComponent)
@@ -57,13 +72,27 @@ void UGSCUserWidget::RegisterAbilitySystemDelegates()
 		return;
 	}
 
-	TArray<FGameplayAttribute> Attributes;
-	AbilitySystemComponent->GetAllAttributes(Attributes);
-
-	for (FGameplayAttribute Attribute : Attributes)
+	if (UGSCAbilitySystemComponent* CompanionASC = Cast<UGSCAbilitySystemComponent>(AbilitySystemComponent))
 	{
-		GSC_LOG(Verbose, TEXT("UGSCUserWidget::SetupAbilitySystemComponentListeners - Setup callback for %s (%s)"), *Attribute.GetName(), *GetNameSafe(OwnerActor));
-		AbilitySystemComponent->GetGameplayAttributeValueChangeDelegate(Attribute).AddUObject(this, &UGSCUserWidget::OnAttributeChanged);
+		// Single binding to the ASC attribute change dispatcher, instead of one per attribute
+		GSC_LOG(Verbose, TEXT("UGSCUserWidget::SetupAbilitySystemComponentListeners - Setup attribute change dispatcher callback (%s)"), *GetNameSafe(OwnerActor));
+		CompanionASC->RegisterAttributeChangeDispatcher();
+		CompanionASC->OnAnyAttributeValueChangeDelegate.AddUObject(this, &UGSCUserWidget::OnAttributeChanged);
+
+		// Cooldowns are tracked by the ASC, instead of registering tag events on each commit
+		CompanionASC->GetCooldownTracker().OnCooldownStart.AddUObject(this, &UGSCUserWidget::OnTrackedCooldownStart);
+		CompanionASC->GetCooldownTracker().OnCooldownEnd.AddUObject(this, &UGSCUserWidget::OnTrackedCooldownEnd);
+	}
+	else
+	{
+		TArray<FGameplayAttribute> Attributes;
+		AbilitySystemComponent->GetAllAttributes(Attributes);
+
+		for (FGameplayAttribute Attribute : Attributes)
+		{
+			GSC_LOG(Verbose, TEXT("UGSCUserWidget::SetupAbilitySystemComponentListeners - Setup callback for %s (%s)"), *Attribute.GetName(), *GetNameSafe(OwnerActor));
+			AbilitySystemComponent->GetGameplayAttributeValueChangeDelegate(Attribute).AddUObject(this, &UGSCUserWidget::OnAttributeChanged);
+		}
 	}
 
 	// Handle GameplayEffects added / remove
@@ -71,10 +100,16 @@ void UGSCUserWidget::RegisterAbilitySystemDelegates()
 	AbilitySystemComponent->OnAnyGameplayEffectRemovedDelegate().AddUObject(this, &UGSCUserWidget::OnAnyGameplayEffectRemoved);
 
 	// Handle generic GameplayTags added / removed
-	AbilitySystemComponent->RegisterGenericGameplayTagEvent().AddUObject(this, &UGSCUserWidget::OnAnyGameplayTagChanged);
+	if (bBroadcastGameplayTagChanges)
+	{
+		AbilitySystemComponent->RegisterGenericGameplayTagEvent().AddUObject(this, &UGSCUserWidget::OnAnyGameplayTagChanged);
+	}
 
-	// Handle Ability Commit events
-	AbilitySystemComponent->AbilityCommittedCallbacks.AddUObject(this, &UGSCUserWidget::OnAbilityCommitted);
+	// Handle Ability Commit events (for cooldowns, when not tracked by a GSC ASC)
+	if (!Cast<UGSCAbilitySystemComponent>(AbilitySystemComponent))
+	{
+		AbilitySystemComponent->AbilityCommittedCallbacks.AddUObject(this, &UGSCUserWidget::OnAbilityCommitted);
+	}
 }
 
 void UGSCUserWidget::ShutdownAbilitySystemComponentListeners() const
@@ -84,12 +119,21 @@ void UGSCUserWidget::ShutdownAbilitySystemComponentListeners() const
 		return;
 	}
 
-	TArray<FGameplayAttribute> Attributes;
-	AbilitySystemComponent->GetAllAttributes(Attributes);
-
-	for (const FGameplayAttribute& Attribute : Attributes)
+	if (UGSCAbilitySystemComponent* CompanionASC = Cast<UGSCAbilitySystemComponent>(AbilitySystemComponent))
+	{
+		CompanionASC->OnAnyAttributeValueChangeDelegate.RemoveAll(this);
+		CompanionASC->GetCooldownTracker().OnCooldownStart.RemoveAll(this);
+		CompanionASC->GetCooldownTracker().OnCooldownEnd.RemoveAll(this);
+	}
+	else
 	{
-		AbilitySystemComponent->GetGameplayAttributeValueChangeDelegate(Attribute).RemoveAll(this);
+		TArray<FGameplayAttribute> Attributes;
+		AbilitySystemComponent->GetAllAttributes(Attributes);
+
+		for (const FGameplayAttribute& Attribute : Attributes)
+		{
+			AbilitySystemComponent->GetGameplayAttributeValueChangeDelegate(Attribute).RemoveAll(this);
+		}
 	}
 
 	AbilitySystemComponent->OnActiveGameplayEffectAddedDelegateToSelf.RemoveAll(this);
@@ -184,7 +228,12 @@ void UGSCUserWidget::OnActiveGameplayEffectAdded(UAbilitySystemComponent* Target
 		AbilitySystemComponent->OnGameplayEffectTimeChangeDelegate(ActiveHandle)->AddUObject(this, &UGSCUserWidget::OnActiveGameplayEffectTimeChanged);
 
 		// Store active handles to clear out bound delegates when shutting down listeners
-		GameplayEffectAddedHandles.AddUnique(ActiveHandle);
+		bool bAlreadyTracked = false;
+		GameplayEffectAddedHandles.Add(ActiveHandle, &bAlreadyTracked);
+		if (!bAlreadyTracked)
+		{
+			INC_DWORD_STAT(STAT_GSC_UserWidgetEffectHandles);
+		}
 	}
 
 	HandleGameplayEffectAdded(AssetTags, GrantedTags, ActiveHandle);
@@ -247,14 +296,29 @@ void UGSCUserWidget::OnAnyGameplayEffectRemoved(const FActiveGameplayEffect& Eff
 	FGameplayTagContainer GrantedTags;
 	EffectRemoved.Spec.GetAllGrantedTags(GrantedTags);
 
+	// Delegates bound to this handle go away with the effect, no need to keep track of it anymore
+	if (GameplayEffectAddedHandles.Remove(EffectRemoved.Handle) > 0)
+	{
+		DEC_DWORD_STAT(STAT_GSC_UserWidgetEffectHandles);
+	}
+
 	// Broadcast any GameplayEffect change to HUD
 	HandleGameplayEffectStackChange(AssetTags, GrantedTags, EffectRemoved.Handle, 0, 1);
 	HandleGameplayEffectRemoved(AssetTags, GrantedTags, EffectRemoved.Handle);
 }
 
+void UGSCUserWidget::SetGameplayTagChangeFilter(const FGSCGameplayTagChangeFilter& InFilter)
+{
+	GameplayTagChangeFilter = InFilter;
+	GameplayTagChangeFilter.ResetCache();
+}
+
 void UGSCUserWidget::OnAnyGameplayTagChanged(const FGameplayTag GameplayTag, const int32 NewCount)
 {
-	HandleGameplayTagChange(GameplayTag, NewCount);
+	if (GameplayTagChangeFilter.Matches(GameplayTag))
+	{
+		HandleGameplayTagChange(GameplayTag, NewCount);
+	}
 }
 
 void UGSCUserWidget::OnAbilityCommitted(UGameplayAbility* ActivatedAbility)
@@ -312,6 +376,16 @@ void UGSCUserWidget::OnAbilityCommitted(UGameplayAbility* ActivatedAbility)
 	}
 }
 
+void UGSCUserWidget::OnTrackedCooldownStart(UGameplayAbility* Ability, const FGameplayTagContainer& CooldownTags, const float TimeRemaining, const float Duration)
+{
+	HandleCooldownStart(Ability, CooldownTags, TimeRemaining, Duration);
+}
+
+void UGSCUserWidget::OnTrackedCooldownEnd(UGameplayAbility* Ability, const FGameplayTag& CooldownTag, const float Duration)
+{
+	HandleCooldownEnd(Ability, CooldownTag, Duration);
+}
+
 void UGSCUserWidget::OnCooldownGameplayTagChanged(const FGameplayTag GameplayTag, const int32 NewCount, FGameplayAbilitySpecHandle AbilitySpecHandle, float Duration)
 {
 	if (NewCount != 0)
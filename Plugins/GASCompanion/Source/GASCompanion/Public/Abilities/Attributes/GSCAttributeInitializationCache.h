@@ -0,0 +1,106 @@
+// Copyright 2021 Mickael Daniel. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/ObjectKey.h"
+
+class UAttributeSet;
+class UDataTable;
+enum class EReloadCompleteReason;
+
+/**
+ * Values of an attribute initialization data table (FAttributeMetaData rows), compiled for a given Attribute Set class.
+ *
+ * Row names are matched against the class properties once, leaving a flat list of property / value pairs to write into each new instance.
+ */
+struct GASCOMPANION_API FGSCAttributeInitializationTable
+{
+	struct FEntry
+	{
+		/** Set for FGameplayAttributeData properties */
+		const FStructProperty* AttributeDataProperty = nullptr;
+
+		/** Set for plain numeric properties */
+		const FNumericProperty* NumericProperty = nullptr;
+
+		float Value = 0.f;
+	};
+
+	TArray<FEntry> Entries;
+
+	/** Writes compiled values to the passed in Attribute Set, same result as UAttributeSet::InitFromMetaDataTable() */
+	void Apply(UAttributeSet* InAttributeSet) const;
+};
+
+/**
+ * Cache of compiled attribute initialization tables, keyed by Attribute Set class and data table.
+ *
+ * UAttributeSet::InitFromMetaDataTable() walks all properties of the set and does a string row lookup for each of them,
+ * every time a set is spawned. UGSCAttributeSetBase overrides it to use tables compiled on first use instead. Other sets
+ * (or subclasses overriding InitFromMetaDataTable) keep their own implementation, as sets are always initialized
+ * through the virtual.
+ *
+ * Compiled tables are dropped whenever the data table changes (reimport, edit) or classes are reinstanced in editor.
+ * Entries of garbage collected classes / data tables are pruned whenever a new table is compiled.
+ *
+ * Also used to reset pooled Attribute Sets in place, see UGSCAbilitySystemComponent::bPoolAttributeSetsOnSpawn.
+ */
+class GASCOMPANION_API FGSCAttributeInitializationCache
+{
+public:
+	FGSCAttributeInitializationCache();
+	~FGSCAttributeInitializationCache();
+
+	static FGSCAttributeInitializationCache& Get();
+
+	/** Initializes the Attribute Set from the data table, through UAttributeSet::InitFromMetaDataTable() */
+	void InitAttributeSet(UAttributeSet* InAttributeSet, const UDataTable* InDataTable);
+
+	/** Writes the compiled data table values to the Attribute Set, compiling the table on first use. Used by UGSCAttributeSetBase::InitFromMetaDataTable(). */
+	void ApplyCompiledTable(UAttributeSet* InAttributeSet, const UDataTable* InDataTable);
+
+	/**
+	 * Puts back an existing Attribute Set in the same state as a freshly created one: attributes are restored to the
+	 * class defaults, then initialized from the data table (if any).
+	 */
+	void ResetAttributeSet(UAttributeSet* InAttributeSet, const UDataTable* InDataTable);
+
+	/** Returns the compiled table for this Attribute Set class and data table, compiling it if needed */
+	TSharedRef<const FGSCAttributeInitializationTable> FindOrCompile(const UClass* InAttributeSetClass, const UDataTable* InDataTable);
+
+	/** Drops compiled tables for this data table, and stops listening to its changes */
+	void Invalidate(const UDataTable* InDataTable);
+
+	/** Drops all compiled tables */
+	void Reset();
+
+	/** Drops entries of Attribute Set classes and data tables that were garbage collected */
+	void PruneStaleEntries();
+
+private:
+	using FTableKey = TPair<TObjectKey<UClass>, TObjectKey<UDataTable>>;
+
+	TMap<FTableKey, TSharedRef<const FGSCAttributeInitializationTable>> Tables;
+
+	/** Attribute properties (numeric or FGameplayAttributeData) per Attribute Set class, restored from the CDO on reset */
+	TMap<TObjectKey<UClass>, TArray<const FProperty*>> AttributeProperties;
+
+	/** Data tables we're listening to for changes, with their OnDataTableChanged delegate handle */
+	TMap<TObjectKey<UDataTable>, FDelegateHandle> ObservedDataTables;
+
+	/** Stops listening to changes of a data table, if it is still around */
+	static void StopObserving(const TObjectKey<UDataTable>& InDataTableKey, const FDelegateHandle& InHandle);
+
+	static TSharedRef<const FGSCAttributeInitializationTable> Compile(const UClass* InAttributeSetClass, const UDataTable* InDataTable);
+
+	static void HandleDataTableChanged(TWeakObjectPtr<const UDataTable> InDataTable);
+
+#if WITH_EDITOR
+	FDelegateHandle ObjectsReplacedHandle;
+	FDelegateHandle ReloadCompleteHandle;
+
+	void HandleObjectsReplaced(const TMap<UObject*, UObject*>& InReplacementMap);
+	void HandleReloadComplete(EReloadCompleteReason InReason);
+#endif
+};
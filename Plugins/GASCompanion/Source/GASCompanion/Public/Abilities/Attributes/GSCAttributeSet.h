@@ -34,10 +34,10 @@ class GASCOMPANION_API UGSCAttributeSet : public UGSCAttributeSetBase
 	GENERATED_BODY()
 
 public:
+	UGSCAttributeSet();
 
 	// AttributeSet Overrides
 	virtual void PreAttributeChange(const FGameplayAttribute& Attribute, float& NewValue) override;
-	virtual void PostGameplayEffectExecute(const FGameplayEffectModCallbackData& Data) override;
 	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
 
 	// Current Health, when 0 we expect owner to die unless prevented by an ability. Capped by MaxHealth.
@@ -128,11 +128,33 @@ protected:
 	UFUNCTION()
 	virtual void OnRep_StaminaRegenRate(const FGameplayAttributeData& OldStaminaRegenRate);
 
+	virtual void HandlePostGameplayEffectExecute(const FGSCAttributeSetExecutionContext& ExecutionContext) override;
+
 	virtual void SetAttributeClamped(const FGameplayAttribute& Attribute, const float Value, const float MaxValue);
 
+	/** Attribute handlers, only resolving from the execution context what they need */
+	virtual void HandleDamageAttributeWithContext(const FGSCAttributeSetExecutionContext& ExecutionContext);
+	virtual void HandleStaminaDamageAttributeWithContext(const FGSCAttributeSetExecutionContext& ExecutionContext);
+	virtual void HandleHealthAttributeWithContext(const FGSCAttributeSetExecutionContext& ExecutionContext);
+	virtual void HandleStaminaAttributeWithContext(const FGSCAttributeSetExecutionContext& ExecutionContext);
+	virtual void HandleManaAttributeWithContext(const FGSCAttributeSetExecutionContext& ExecutionContext);
+
+	/** Attribute handlers taking the fully resolved execution data, only dispatched to when bDispatchExecutionDataHandlers is set */
 	virtual void HandleDamageAttribute(const FGSCAttributeSetExecutionData& ExecutionData);
 	virtual void HandleStaminaDamageAttribute(const FGSCAttributeSetExecutionData& ExecutionData);
 	virtual void HandleHealthAttribute(const FGSCAttributeSetExecutionData& ExecutionData);
 	virtual void HandleStaminaAttribute(const FGSCAttributeSetExecutionData& ExecutionData);
 	virtual void HandleManaAttribute(const FGSCAttributeSetExecutionData& ExecutionData);
+
+	/**
+	 * Whether attributes are dispatched to the FGSCAttributeSetExecutionData handlers (resolving the whole execution data
+	 * for every handled attribute), instead of the execution context ones.
+	 *
+	 * Enabled for native subclasses, which may still override the execution data handlers (Blueprint subclasses can't).
+	 * Native subclasses only overriding the execution context handlers should disable it in their constructor.
+	 */
+	bool bDispatchExecutionDataHandlers = false;
+
+private:
+	void DispatchExecutionDataHandlers(const FGSCAttributeSetExecutionContext& ExecutionContext);
 };
@@ -73,6 +73,105 @@ struct FGSCAttributeSetExecutionData
 	float DeltaValue;
 };
 
+/**
+ * Lightweight view over FGameplayEffectModCallbackData, shared between an AttributeSet PostGameplayEffectExecute and the
+ * target's Core Component.
+ *
+ * Unlike FGSCAttributeSetExecutionData, nothing is resolved upfront: actors, controllers and core components are looked up
+ * on first access and cached, and tags are returned by reference into the effect spec instead of being copied.
+ *
+ * Only valid for the duration of the PostGameplayEffectExecute call it was created in.
+ */
+class GASCOMPANION_API FGSCAttributeSetExecutionContext
+{
+public:
+	explicit FGSCAttributeSetExecutionContext(const FGameplayEffectModCallbackData& InData)
+		: Data(InData)
+	{
+	}
+
+	FGSCAttributeSetExecutionContext(const FGSCAttributeSetExecutionContext&) = delete;
+	FGSCAttributeSetExecutionContext& operator=(const FGSCAttributeSetExecutionContext&) = delete;
+
+	/** The gameplay effect mod callback data this context was created from */
+	const FGameplayEffectModCallbackData& GetModCallbackData() const
+	{
+		return Data;
+	}
+
+	/** This tells us how we got here (who / what applied us) */
+	const FGameplayEffectContextHandle& GetContext() const
+	{
+		return Data.EffectSpec.GetContext();
+	}
+
+	/** Combination of spec and actor tags for the captured Source Tags on GameplayEffectSpec creation */
+	const FGameplayTagContainer& GetSourceTags() const
+	{
+		return *Data.EffectSpec.CapturedSourceTags.GetAggregatedTags();
+	}
+
+	/** All tags that apply to the gameplay effect spec. Gathered on first access, as the spec doesn't store them in a single container. */
+	const FGameplayTagContainer& GetSpecAssetTags() const;
+
+	/** The ability system component of the instigator that started the whole chain */
+	UAbilitySystemComponent* GetSourceASC() const;
+
+	/** The physical representation of the Source ASC (The ability system component of the instigator that started the whole chain) */
+	AActor* GetSourceActor() const;
+
+	/** The physical representation of the owner (Avatar) for the target we intend to apply to  */
+	AActor* GetTargetActor() const;
+
+	/** PlayerController associated with the owning actor for the Source ASC */
+	APlayerController* GetSourceController() const;
+
+	/** PlayerController associated with the owning actor for the target we intend to apply to */
+	APlayerController* GetTargetController() const;
+
+	/** The Source Actor as a APawn */
+	APawn* GetSourcePawn() const;
+
+	/** The Target Actor as a APawn */
+	APawn* GetTargetPawn() const;
+
+	/** GAS Companion Core actor component attached to Source Actor (if any) */
+	UGSCCoreComponent* GetSourceCoreComponent() const;
+
+	/** GAS Companion Core actor component attached to Target Actor (if any) */
+	UGSCCoreComponent* GetTargetCoreComponent() const;
+
+	/** The object this effect was created from. */
+	UObject* GetSourceObject() const
+	{
+		return GetContext().GetSourceObject();
+	}
+
+	/** Holds the delta value between old and new, if it is available (for Additive Operations) */
+	float GetDeltaValue() const
+	{
+		return Data.EvaluatedData.ModifierOp == EGameplayModOp::Type::Additive ? Data.EvaluatedData.Magnitude : 0.f;
+	}
+
+	/** Fills out the legacy execution data structure, resolving everything */
+	void ToExecutionData(FGSCAttributeSetExecutionData& OutExecutionData) const;
+
+private:
+	const FGameplayEffectModCallbackData& Data;
+
+	mutable FGameplayTagContainer SpecAssetTags;
+	mutable AActor* SourceActor = nullptr;
+	mutable AActor* TargetActor = nullptr;
+	mutable UGSCCoreComponent* SourceCoreComponent = nullptr;
+	mutable UGSCCoreComponent* TargetCoreComponent = nullptr;
+
+	mutable bool bSpecAssetTagsResolved = false;
+	mutable bool bSourceActorResolved = false;
+	mutable bool bTargetActorResolved = false;
+	mutable bool bSourceCoreComponentResolved = false;
+	mutable bool bTargetCoreComponentResolved = false;
+};
+
 // Uses macros from AttributeSet.h
 #define ATTRIBUTE_ACCESSORS(ClassName, PropertyName) \
     GAMEPLAYATTRIBUTE_PROPERTY_GETTER(ClassName, PropertyName) \
@@ -102,6 +201,9 @@ public:
 	virtual void PostGameplayEffectExecute(const FGameplayEffectModCallbackData& Data) override;
 	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
 
+	/** Same result as the base implementation, from the data table compiled once per class (see FGSCAttributeInitializationCache) */
+	virtual void InitFromMetaDataTable(const UDataTable* DataTable) override;
+
 	/** Helper function to get the minimum clamp value for a given attribute. Subclasses are expected to override this. */
 	virtual float GetClampMinimumValueFor(const FGameplayAttribute& Attribute);
 
@@ -149,6 +251,14 @@ public:
 
 protected:
 
+	/**
+	 * Called from PostGameplayEffectExecute with a lazily resolved execution context, shared with the target Core Component.
+	 *
+	 * Subclasses should override this one rather than PostGameplayEffectExecute, to avoid resolving the same information twice.
+	 * Base implementation forwards the event to the target Core Component.
+	 */
+	virtual void HandlePostGameplayEffectExecute(const FGSCAttributeSetExecutionContext& ExecutionContext);
+
 	/**
 	 * Fills out FGSCAttributeSetExecutionData structure based on provided data.
 	 *
@@ -5,6 +5,7 @@
 #include "CoreMinimal.h"
 #include "GameplayEffect.h"
 #include "Engine/DataAsset.h"
+#include "Engine/StreamableManager.h"
 #include "GameFeatures/GSCGameFeatureTypes.h"
 #include "GSCAbilitySet.generated.h"
 
@@ -114,6 +115,41 @@ struct FGSCAbilitySetHandle
 	}
 };
 
+/**
+ * Keeps track of an async Ability Set load. Holds on to the streamable handles, so that loaded assets stay in memory
+ * for as long as this handle is alive.
+ */
+struct GASCOMPANION_API FGSCAbilitySetLoadHandle
+{
+	/** Handle for the Ability Sets themselves, only set if any of them needed loading */
+	TSharedPtr<FStreamableHandle> AbilitySetsHandle;
+
+	/** Handle for the soft references of the sets (abilities, input actions, attribute sets, data tables and effects) */
+	TSharedPtr<FStreamableHandle> ContentHandle;
+
+	/** Returns whether any of the streamable requests is still in flight */
+	bool IsLoadingInProgress() const
+	{
+		return (AbilitySetsHandle.IsValid() && AbilitySetsHandle->IsLoadingInProgress()) || (ContentHandle.IsValid() && ContentHandle->IsLoadingInProgress());
+	}
+
+	/** Cancels any in flight request. Completion delegate won't be called. */
+	void CancelHandle()
+	{
+		if (AbilitySetsHandle.IsValid())
+		{
+			AbilitySetsHandle->CancelHandle();
+		}
+
+		if (ContentHandle.IsValid())
+		{
+			ContentHandle->CancelHandle();
+		}
+	}
+};
+
+DECLARE_DELEGATE_TwoParams(FGSCOnAbilitySetGranted, bool /* bSuccess */, const FGSCAbilitySetHandle& /* AbilitySetHandle */);
+
 /**
  * DataAsset that can be used to define and give to an AbilitySystemComponent a set of:
  *
@@ -171,6 +207,20 @@ public:
 	 */
 	bool GrantToAbilitySystem(const AActor* InActor, FGSCAbilitySetHandle& OutAbilitySetHandle, FText* OutErrorText = nullptr) const;
 
+	/**
+	 * Grants itself (Ability Set) to several ASCs at once, typically a wave of actors spawned together.
+	 *
+	 * Soft references and attribute initialization data are resolved only once for the whole batch, instead of once per ASC.
+	 *
+	 * @param InASCs AbilitySystemComponent pointers to operate on
+	 * @param OutAbilitySetHandles Handles that can be used to remove the set later on, matching InASCs order (left invalid for ASCs the set couldn't be granted to)
+	 * @param OutErrorText Reason of error in case of failed operation
+	 * @param bShouldRegisterCoreDelegates Whether the set on successful application should try to register GSCCoreComponent delegates on Avatar Actors.
+	 *
+	 * @return True if the ability set was granted successfully to every ASC, false otherwise
+	 */
+	bool GrantToAbilitySystems(TArrayView<UAbilitySystemComponent* const> InASCs, TArray<FGSCAbilitySetHandle>& OutAbilitySetHandles, FText* OutErrorText = nullptr, const bool bShouldRegisterCoreDelegates = true) const;
+
 	/**
 	 * Removes the AbilitySet represented by InAbilitySetHandle from the passed in ASC. Clears out any previously granted Abilities,
 	 * Attributes and Effects from the set.
@@ -198,6 +248,38 @@ public:
 	 */
 	static bool RemoveFromAbilitySystem(const AActor* InActor, FGSCAbilitySetHandle& InAbilitySetHandle, FText* OutErrorText = nullptr);
 
+	/**
+	 * Asynchronously loads every soft reference of the set (abilities, input actions, attribute sets, initialization data
+	 * and effects) in a single streamable request, and grants itself to the passed in ASC once loaded.
+	 *
+	 * The delegate is invoked right away if everything is already in memory. It is invoked with bSuccess false if either
+	 * the set or the ASC got garbage collected in the meantime.
+	 *
+	 * @param InASC AbilitySystemComponent pointer to operate on
+	 * @param OnGranted Delegate invoked once the set has been granted (or failed to)
+	 * @param bShouldRegisterCoreDelegates Whether the set on successful application should try to register GSCCoreComponent delegates on Avatar Actor.
+	 *
+	 * @return Handle of the load request. Releasing it (or calling CancelHandle()) cancels the grant.
+	 */
+	TSharedRef<FGSCAbilitySetLoadHandle> GrantToAbilitySystemAsync(UAbilitySystemComponent* InASC, const FGSCOnAbilitySetGranted& OnGranted, const bool bShouldRegisterCoreDelegates = true) const;
+
+	/**
+	 * Asynchronously loads the passed in Ability Sets along with all of their soft references, batched into at most two
+	 * streamable requests (one for the sets not yet loaded, one for the content of all the sets).
+	 *
+	 * The delegate is invoked right away if everything is already in memory. Releasing the returned handle before
+	 * completion cancels the load and the delegate won't be called.
+	 */
+	static TSharedRef<FGSCAbilitySetLoadHandle> LoadAbilitySetsAsync(const TArray<TSoftObjectPtr<UGSCAbilitySet>>& InAbilitySets, const FSimpleDelegate& OnLoaded);
+
+	/**
+	 * Gathers soft references of this set that are not loaded yet.
+	 *
+	 * Those are also tagged with the "AbilitySet" asset bundle, for projects registering Ability Sets as primary assets
+	 * and loading them through the Asset Manager.
+	 */
+	void GetUnloadedSoftObjectPaths(TArray<FSoftObjectPath>& OutPaths) const;
+
 	/** Returns whether this Ability Set needs Input Binding, eg. does any of the Granted Abilities in this set have a defined Input Action to bind */
 	bool HasInputBinding() const;
 
@@ -0,0 +1,93 @@
+// Copyright 2021 Mickael Daniel. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameplayAbilitySpec.h"
+#include "Templates/Function.h"
+#include "Templates/SubclassOf.h"
+#include "UObject/ObjectKey.h"
+
+class UGameplayAbility;
+
+/**
+ * Lookup tables over an ASC ActivatableAbilities list, kept up to date from OnGiveAbility / OnRemoveAbility.
+ *
+ * Entries reference specs by handle, along with a cached index into the ActivatableAbilities items. The cached index
+ * is validated on every access and resolved again with a linear search if the list was reordered (replication, removals).
+ *
+ * Spec InputIDs can change at any time after a spec is granted (input binding, replication), so the InputID table is
+ * lazily rebuilt on next access once flagged dirty with MarkInputIDsDirty(). InputIDs allocated by input bindings are
+ * dense (see FGSCInputIDAllocator), and are looked up in a flat array. Others (game defined InputIDs) go in a map.
+ */
+class GASCOMPANION_API FGSCAbilitySpecIndex
+{
+public:
+	/** Adds the spec to the index. Called from OnGiveAbility. */
+	void AddSpec(const FGameplayAbilitySpec& InSpec, const TArray<FGameplayAbilitySpec>& InItems);
+
+	/** Removes the spec from the index. Called from OnRemoveAbility. */
+	void RemoveSpec(const FGameplayAbilitySpec& InSpec);
+
+	/** Clears out the whole index */
+	void Reset();
+
+	/** Flags the InputID table for a rebuild on next access. Must be called whenever a spec InputID changes. */
+	void MarkInputIDsDirty()
+	{
+		bInputIDsDirty = true;
+	}
+
+	/** Gathers positions in the ActivatableAbilities items of the specs bound to the given InputID, in items order */
+	void FindSpecsWithInputID(const TArray<FGameplayAbilitySpec>& InItems, const int32 InInputID, TArray<int32, TInlineAllocator<4>>& OutItemIndices);
+
+	/** Returns the handle of the spec granted with this exact ability class and level, if any */
+	FGameplayAbilitySpecHandle FindSpecHandleByClassAndLevel(const TArray<FGameplayAbilitySpec>& InItems, const UClass* InAbilityClass, const int32 InLevel) const;
+
+	/**
+	 * Invokes the visitor for every active ability instance whose class is (or is a child of) the given class.
+	 *
+	 * The visitor returns false to stop iterating.
+	 */
+	void ForEachActiveAbilityOfClass(const TArray<FGameplayAbilitySpec>& InItems, const TSubclassOf<UGameplayAbility> InAbilityClass, TFunctionRef<bool(UGameplayAbility*)> InVisitor) const;
+
+	/** Invokes the visitor for every active ability instance of the passed in spec. The visitor returns false to stop iterating. */
+	static bool ForEachActiveAbilityInstance(const FGameplayAbilitySpec& InSpec, TFunctionRef<bool(UGameplayAbility*)> InVisitor);
+
+private:
+	struct FIndexedSpec
+	{
+		FGameplayAbilitySpecHandle Handle;
+
+		/** Last known position in the ActivatableAbilities items, only a hint */
+		mutable int32 ItemIndex = INDEX_NONE;
+
+		bool operator==(const FGameplayAbilitySpecHandle& InHandle) const
+		{
+			return Handle == InHandle;
+		}
+	};
+
+	using FIndexedSpecs = TArray<FIndexedSpec, TInlineAllocator<2>>;
+
+	/** Granted specs keyed by their exact ability class */
+	TMap<TObjectKey<UClass>, FIndexedSpecs> SpecsByClass;
+
+	/** InputIDs below this one are indexed in SpecsByDenseInputID */
+	static constexpr int32 MaxDenseInputID = 256;
+
+	/** Granted specs indexed by their current InputID (several specs may share the same InputID) */
+	TArray<FIndexedSpecs> SpecsByDenseInputID;
+
+	/** Same as above, for InputIDs out of the dense range */
+	TMap<int32, FIndexedSpecs> SpecsBySparseInputID;
+
+	const FIndexedSpecs* FindSpecsByInputID(int32 InInputID) const;
+
+	bool bInputIDsDirty = true;
+
+	void RebuildInputIDs(const TArray<FGameplayAbilitySpec>& InItems);
+
+	/** Returns the current position of the indexed spec in the ActivatableAbilities items, or INDEX_NONE if it is no longer there */
+	static int32 ResolveItemIndex(const TArray<FGameplayAbilitySpec>& InItems, const FIndexedSpec& InIndexedSpec);
+};
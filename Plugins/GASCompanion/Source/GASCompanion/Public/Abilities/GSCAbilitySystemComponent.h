@@ -6,6 +6,9 @@
 #include "AbilitySystemComponent.h"
 #include "GSCTypes.h"
 #include "Abilities/GSCAbilitySet.h"
+#include "Abilities/GSCAbilitySpecIndex.h"
+#include "Abilities/GSCCooldownTracker.h"
+#include "Abilities/GSCInputIDAllocator.h"
 #include "GSCAbilitySystemComponent.generated.h"
 
 class UGSCAbilityInputBindingComponent;
@@ -83,7 +86,10 @@ struct FGSCMappedAbility
 };
 
 DECLARE_MULTICAST_DELEGATE_OneParam(FGSCOnGiveAbility, FGameplayAbilitySpec&);
+DECLARE_MULTICAST_DELEGATE(FGSCOnAbilitySpecsChanged);
+DECLARE_MULTICAST_DELEGATE_OneParam(FGSCOnAnyAttributeValueChange, const FOnAttributeChangeData&);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE(FGSCOnInitAbilityActorInfo);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE(FGSCOnDefaultAbilitySetsGranted);
 
 /**
  * Revamped Ability System Component for 3.0.0
@@ -127,6 +133,14 @@ public:
 	UPROPERTY(BlueprintAssignable, Category="GAS Companion|Abilities")
 	FGSCOnInitAbilityActorInfo OnInitAbilityActorInfo;
 
+	/**
+	 * Event called once GrantedAbilitySets have been granted.
+	 *
+	 * With bGrantAbilitySetsAsync, this may happen after OnInitAbilityActorInfo, once the sets and their content finished loading.
+	 */
+	UPROPERTY(BlueprintAssignable, Category="GAS Companion|Ability Sets")
+	FGSCOnDefaultAbilitySetsGranted OnDefaultAbilitySetsGranted;
+
 	/**
 	 * Specifically set abilities to persist across deaths / respawns or possessions (Default is true)
 	 *
@@ -149,10 +163,55 @@ public:
 	UPROPERTY(EditDefaultsOnly, Category = "GAS Companion|Abilities")
 	bool bResetAttributesOnSpawn = true;
 
+	/**
+	 * When attributes are reset on spawn, reset previously granted Attribute Sets in place to their initialization values,
+	 * instead of removing them and creating new instances (Default is false)
+	 *
+	 * Avoids steady UObject churn and GC pressure for actors respawning frequently. Applies to default attributes, as well as
+	 * attributes granted from a Game Feature action.
+	 */
+	UPROPERTY(EditDefaultsOnly, Category = "GAS Companion|Abilities", meta=(EditCondition="bResetAttributesOnSpawn"))
+	bool bPoolAttributeSetsOnSpawn = false;
+
+	/**
+	 * Load GrantedAbilitySets (and everything they reference) asynchronously, granting them once loaded instead of
+	 * blocking the game thread with synchronous loads during InitAbilityActorInfo (Default is false)
+	 *
+	 * Sets already in memory are still granted right away. Bind to OnDefaultAbilitySetsGranted to know when sets were granted.
+	 */
+	UPROPERTY(EditDefaultsOnly, Category = "GAS Companion|Ability Sets")
+	bool bGrantAbilitySetsAsync = false;
+
+	/**
+	 * Start loading GrantedAbilitySets (and everything they reference) as soon as the component is registered, which
+	 * happens at map load for placed actors, so that they're already in memory by the time InitAbilityActorInfo runs (Default is false)
+	 */
+	UPROPERTY(EditDefaultsOnly, Category = "GAS Companion|Ability Sets")
+	bool bPreloadAbilitySets = false;
+
 	/** Delegate invoked OnGiveAbility (when an ability is granted and available) */
 	FGSCOnGiveAbility OnGiveAbilityDelegate;
 
+	/** Delegate invoked whenever activatable ability specs change (granted, removed, or replicated), which may reset spec InputIDs */
+	FGSCOnAbilitySpecsChanged OnAbilitySpecsChangedDelegate;
+
+	/**
+	 * Delegate invoked whenever any attribute value changes on this ASC.
+	 *
+	 * The ASC binds a single dispatcher to each attribute value change delegate and forwards to this one, so that listeners
+	 * (Core Component, User Widgets, ...) bind once instead of once per attribute.
+	 */
+	FGSCOnAnyAttributeValueChange OnAnyAttributeValueChangeDelegate;
+
+	/**
+	 * Binds the attribute change dispatcher to any attribute not handled yet.
+	 *
+	 * Called after default attributes and Ability Sets are granted, and should be called again whenever Attribute Sets are added manually.
+	 */
+	void RegisterAttributeChangeDispatcher();
+
 	//~ Begin UActorComponent interface
+	virtual void OnRegister() override;
 	virtual void BeginPlay() override;
 	//~ End UActorComponent interface
 
@@ -168,6 +227,9 @@ public:
 	 * (if child of GSCMeleeAbility, will activate combo via combo component)
 	 */
 	virtual void AbilityLocalInputPressed(int32 InputID) override;
+
+	/** Overrides InputReleased to go through the InputID index instead of iterating all activatable abilities */
+	virtual void AbilityLocalInputReleased(int32 InputID) override;
 	//~ End UAbilitySystemComponent interface
 
 	/**
@@ -231,6 +293,51 @@ public:
 	/** Called from GrantDefaultAbilitySets. Determine if ability set should be granted, prevents re-granting a set previously added */
 	virtual bool ShouldGrantAbilitySet(const UGSCAbilitySet* InAbilitySet) const;
 
+	/** Returns whether an ability instance of the given class (or a child class) is currently active, without building up the list of active abilities */
+	bool HasActiveAbilityOfClass(TSubclassOf<UGameplayAbility> InAbilityClass) const;
+
+	/**
+	 * Allocation free iteration over active ability instances of the given class (or a child class), backed by the ASC ability spec index.
+	 *
+	 * The visitor returns false to stop iterating.
+	 */
+	void ForEachActiveAbilityOfClass(TSubclassOf<UGameplayAbility> InAbilityClass, TFunctionRef<bool(UGameplayAbility*)> InVisitor) const;
+
+	/** Returns the handle of the ability spec granted with this exact ability class and level, if any */
+	FGameplayAbilitySpecHandle FindAbilitySpecHandleFromClassAndLevel(TSubclassOf<UGameplayAbility> InAbilityClass, int32 InLevel) const;
+
+	/**
+	 * Flags the ability spec InputID index as dirty, so that it is rebuilt on next input.
+	 *
+	 * Must be called whenever a spec InputID is changed after the ability was granted (UGSCAbilityInputBindingComponent takes care of it).
+	 */
+	void MarkAbilitySpecInputIDsDirty();
+
+	/** Tracks cooldowns applied by committed abilities, and broadcasts their start / end */
+	FGSCCooldownTracker& GetCooldownTracker()
+	{
+		return CooldownTracker;
+	}
+
+	/** Allocates InputIDs for input bindings of this ASC, keeping them dense */
+	FGSCInputIDAllocator& GetInputIDAllocator()
+	{
+		return InputIDAllocator;
+	}
+
+	/**
+	 * Returns whether the ability is currently on cooldown, along with the remaining time and total duration of the cooldown.
+	 *
+	 * Answered from the cooldowns tracked on commit without going through active effect queries, cheap enough to be polled from UI.
+	 * Remaining time and duration are -1 for cooldowns without a duration.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "GAS Companion|Abilities")
+	bool GetAbilityCooldownRemaining(FGameplayAbilitySpecHandle AbilitySpecHandle, float& TimeRemaining, float& Duration) const;
+
+	/** Same as GetAbilityCooldownRemaining, for the first ability of this class (or a child class) currently on cooldown */
+	UFUNCTION(BlueprintCallable, Category = "GAS Companion|Abilities")
+	bool GetAbilityCooldownRemainingForClass(TSubclassOf<UGameplayAbility> AbilityClass, float& TimeRemaining, float& Duration) const;
+
 protected:
 	// Cached granted Ability Handles
 	UPROPERTY(transient)
@@ -251,17 +358,49 @@ protected:
 	// Keep track of OnGiveAbility handles bound to handle input binding on clients
 	TArray<FDelegateHandle> InputBindingDelegateHandles;
 
+	// Attributes the change dispatcher is already bound to
+	TSet<FGameplayAttribute> DispatchedAttributes;
+
+	// Lookup tables over ActivatableAbilities, maintained from OnGiveAbility / OnRemoveAbility
+	FGSCAbilitySpecIndex AbilitySpecIndex;
+
+	// Cooldowns applied on ability commit, keyed by spec handle
+	FGSCCooldownTracker CooldownTracker;
+
+	FGSCInputIDAllocator InputIDAllocator;
+
+	// In flight async load of GrantedAbilitySets, when bGrantAbilitySetsAsync is enabled
+	TSharedPtr<FGSCAbilitySetLoadHandle> AbilitySetsLoadHandle;
+
+	// Keeps preloaded GrantedAbilitySets in memory, when bPreloadAbilitySets is enabled
+	TSharedPtr<FGSCAbilitySetLoadHandle> AbilitySetsPreloadHandle;
+
 	// Cached ComboComponent on Character (if it has any)
 	UPROPERTY()
 	TObjectPtr<UGSCComboManagerComponent> ComboComponent;
 
 	//~ Begin UAbilitySystemComponent interface
 	virtual void OnGiveAbility(FGameplayAbilitySpec& AbilitySpec) override;
+	virtual void OnRemoveAbility(FGameplayAbilitySpec& AbilitySpec) override;
+	virtual void OnRep_ActivateAbilities() override;
 	//~ End UAbilitySystemComponent interface
 
 	/** Called when Ability System Component is initialized */
 	void GrantStartupEffects();
 
+	/**
+	 * Grants one of the GrantedAbilitySets, unless previously granted.
+	 *
+	 * @return False if the set requires input binding and the avatar isn't ready for it yet, in which case remaining sets are granted on next InitAbilityActorInfo
+	 */
+	virtual bool GrantDefaultAbilitySet(const UGSCAbilitySet* InAbilitySet, AActor* InAvatarActor);
+
+	/** Completion callback of the async GrantedAbilitySets load */
+	void OnDefaultAbilitySetsLoaded();
+
+	/** Forwards a single attribute value change to OnAnyAttributeValueChangeDelegate */
+	void DispatchAttributeValueChange(const FOnAttributeChangeData& Data) const;
+
 	/** Reinit the cached ability actor info (specifically the player controller) */
 	UFUNCTION()
 	void OnPawnControllerChanged(APawn* Pawn, AController* NewController);
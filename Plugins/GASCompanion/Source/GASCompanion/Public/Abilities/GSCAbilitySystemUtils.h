@@ -3,12 +3,15 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "GameplayAbilitySpec.h"
+#include "GameplayTagContainer.h"
 #include "Templates/SubclassOf.h"
 
 class AActor;
 class UAbilitySystemComponent;
 class UActorComponent;
 class UAttributeSet;
+class UDataTable;
 class UGSCAbilityInputBindingComponent;
 class UGSCAbilitySet;
 class UGameplayAbility;
@@ -20,9 +23,53 @@ struct FComponentRequestHandle;
 struct FGSCAbilitySetHandle;
 struct FGSCGameFeatureAbilityMapping;
 struct FGSCGameFeatureAttributeSetMapping;
-struct FGameplayAbilitySpec;
-struct FGameplayAbilitySpecHandle;
-struct FGameplayTagContainer;
+
+/**
+ * Ability Set with its soft references resolved once, so that it can be granted to any number of ASCs without repeating
+ * the work for each of them.
+ *
+ * Ability specs are still built for each ASC with BuildAbilitySpecFromClass, which ASC subclasses may override.
+ *
+ * Resolved objects are not referenced for garbage collection, this is only meant to live within the scope of a grant operation.
+ */
+struct GASCOMPANION_API FGSCResolvedAbilitySet
+{
+	struct FAbility
+	{
+		TSubclassOf<UGameplayAbility> AbilityType;
+		int32 Level = 1;
+
+		UInputAction* InputAction = nullptr;
+		EGSCAbilityTriggerEvent TriggerEvent {};
+	};
+
+	struct FAttributeSet
+	{
+		TSubclassOf<UAttributeSet> AttributeSetType;
+
+		/** Initialization data table, if the mapping has one */
+		const UDataTable* InitializationData = nullptr;
+	};
+
+	struct FEffect
+	{
+		TSubclassOf<UGameplayEffect> EffectType;
+		float Level = 1.f;
+	};
+
+	TArray<FAbility> Abilities;
+	TArray<FAttributeSet> Attributes;
+	TArray<FEffect> Effects;
+	FGameplayTagContainer OwnedTags;
+	FString AbilitySetPathName;
+
+	/**
+	 * Resolves the passed in set. Invalid entries are logged and skipped.
+	 *
+	 * @return False if the set is nullptr
+	 */
+	bool Resolve(const UGSCAbilitySet* InAbilitySet);
+};
 
 /**
  * Utilities class with a bunch of statics to provide common shared code facilities to grant various things to an ASC.
@@ -46,7 +93,23 @@ public:
 	static void TryGrantAttributes(UAbilitySystemComponent* InASC, const FGSCGameFeatureAttributeSetMapping& InAttributeSetMapping, UAttributeSet*& OutAttributeSet);
 	static void TryGrantGameplayEffect(UAbilitySystemComponent* InASC, const TSubclassOf<UGameplayEffect> InEffectType, const float InLevel, TArray<FActiveGameplayEffectHandle>& OutEffectHandles);
 	static bool TryGrantAbilitySet(UAbilitySystemComponent* InASC, const UGSCAbilitySet* InAbilitySet, FGSCAbilitySetHandle& OutAbilitySetHandle, TArray<TSharedPtr<FComponentRequestHandle>>* OutComponentRequests = nullptr);
+
+	/**
+	 * Grants an Ability Set to several ASCs in a single pass (eg. a wave of spawned AIs). Soft references and attribute
+	 * initialization data are resolved once for the whole batch.
+	 *
+	 * OutAbilitySetHandles matches InASCs order. Handles of ASCs the set couldn't be granted to are left invalid.
+	 *
+	 * @return False if the set is nullptr
+	 */
+	static bool TryGrantAbilitySetToMany(TArrayView<UAbilitySystemComponent* const> InASCs, const UGSCAbilitySet* InAbilitySet, TArray<FGSCAbilitySetHandle>& OutAbilitySetHandles, TArray<TSharedPtr<FComponentRequestHandle>>* OutComponentRequests = nullptr);
+
+	/** Grants an already resolved Ability Set, see TryGrantAbilitySet */
+	static bool TryGrantResolvedAbilitySet(UAbilitySystemComponent* InASC, const FGSCResolvedAbilitySet& InResolvedSet, FGSCAbilitySetHandle& OutAbilitySetHandle, TArray<TSharedPtr<FComponentRequestHandle>>* OutComponentRequests = nullptr);
 	
+	/** Resets a previously granted Attribute Set in place to its initialization values, for pooled Attribute Sets reused on respawn */
+	static void ResetAttributeSet(UAttributeSet* InAttributeSet, const UDataTable* InInitializationData);
+
 	/** Helper to return the AttributeSet UObject as a non const pointer, if the passed in ASC has it granted */
 	static UAttributeSet* GetAttributeSet(const UAbilitySystemComponent* InASC, const TSubclassOf<UAttributeSet> InAttributeSet);
 
@@ -72,6 +135,20 @@ public:
 	static void RemoveLooseGameplayTagsUnique(UAbilitySystemComponent* InASC, const FGameplayTagContainer& InTags, const bool bReplicated = true);
 
 private:
+	static void GrantResolvedAbility(UAbilitySystemComponent* InASC, const FGSCResolvedAbilitySet::FAbility& InAbility, FGameplayAbilitySpecHandle& OutAbilityHandle, FGameplayAbilitySpec& OutAbilitySpec);
+	
+	static void BindResolvedAbilityInput(
+		UAbilitySystemComponent* InASC,
+		UInputAction* InInputAction,
+		const EGSCAbilityTriggerEvent InTriggerEvent,
+		const FGameplayAbilitySpecHandle& InAbilityHandle,
+		const FGameplayAbilitySpec& InAbilitySpec,
+		FDelegateHandle& OutOnGiveAbilityDelegateHandle,
+		TArray<TSharedPtr<FComponentRequestHandle>>* OutComponentRequests
+	);
+
+	static void GrantResolvedAttributes(UAbilitySystemComponent* InASC, const FGSCResolvedAbilitySet::FAttributeSet& InAttributeSet, UAttributeSet*& OutAttributeSet);
+
 	/** Handler for AbilitySystem OnGiveAbility delegate. Sets up input binding for clients (not authority) when GameFeatures are activated during Play. */
 	static void HandleOnGiveAbility(
 		FGameplayAbilitySpec& InAbilitySpec,
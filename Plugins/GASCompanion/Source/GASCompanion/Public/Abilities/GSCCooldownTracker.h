@@ -0,0 +1,94 @@
+// Copyright 2021 Mickael Daniel. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameplayAbilitySpec.h"
+#include "GameplayTagContainer.h"
+#include "Engine/EngineTypes.h"
+
+class UAbilitySystemComponent;
+class UGameplayAbility;
+struct FActiveGameplayEffect;
+
+DECLARE_MULTICAST_DELEGATE_FourParams(FGSCOnCooldownStartNative, UGameplayAbility* /*Ability*/, const FGameplayTagContainer& /*CooldownTags*/, float /*TimeRemaining*/, float /*Duration*/);
+DECLARE_MULTICAST_DELEGATE_ThreeParams(FGSCOnCooldownEndNative, UGameplayAbility* /*Ability*/, const FGameplayTag& /*CooldownTag*/, float /*Duration*/);
+
+/**
+ * Keeps track of ability cooldowns for an ASC, from AbilityCommittedCallbacks.
+ *
+ * Cooldown expirations are kept in a min-heap keyed by ability spec handle, with a single world timer set for the
+ * earliest one, instead of registering a gameplay tag event for each cooldown tag on every commit.
+ *
+ * When the timer fires, the cooldown tags are checked against the ASC: a cooldown extended in the meantime is re-queued
+ * with its new remaining time. Cooldown effects removed early are picked up from OnAnyGameplayEffectRemovedDelegate.
+ */
+class GASCOMPANION_API FGSCCooldownTracker
+{
+public:
+	/** Binds to the ASC commit / effect removal delegates */
+	void Initialize(UAbilitySystemComponent* InASC);
+
+	/** Unbinds from the ASC and clears any tracked cooldown, without broadcasting OnCooldownEnd */
+	void Deinitialize();
+
+	/**
+	 * Returns whether the ability spec is currently on cooldown, along with remaining time and total duration.
+	 *
+	 * Answered from the tracked cooldowns only, cheap enough to be polled every frame from UI.
+	 */
+	bool GetCooldownRemaining(const FGameplayAbilitySpecHandle& InSpecHandle, float& OutTimeRemaining, float& OutDuration) const;
+
+	/** Same as above, for the first tracked cooldown of an ability of the given class (or a child class) */
+	bool GetCooldownRemainingForClass(const UClass* InAbilityClass, float& OutTimeRemaining, float& OutDuration) const;
+
+	/** Broadcast when a committed ability applied a cooldown (from the activated ability instance) */
+	FGSCOnCooldownStartNative OnCooldownStart;
+
+	/** Broadcast for each cooldown tag once a cooldown expired (from the spec ability, if still granted) */
+	FGSCOnCooldownEndNative OnCooldownEnd;
+
+private:
+	struct FCooldown
+	{
+		TWeakObjectPtr<const UClass> AbilityClass;
+		FGameplayTagContainer CooldownTags;
+		double ExpirationTime = 0.0;
+		float Duration = 0.f;
+	};
+
+	struct FExpiration
+	{
+		FGameplayAbilitySpecHandle SpecHandle;
+		double ExpirationTime = 0.0;
+
+		bool operator<(const FExpiration& Other) const
+		{
+			return ExpirationTime < Other.ExpirationTime;
+		}
+	};
+
+	TWeakObjectPtr<UAbilitySystemComponent> ASC;
+
+	/** Currently tracked cooldown, per ability spec */
+	TMap<FGameplayAbilitySpecHandle, FCooldown> Cooldowns;
+
+	/** Min-heap of expirations. Entries no longer matching the tracked cooldown (restarted, ended early) are skipped when popped. */
+	TArray<FExpiration> Expirations;
+
+	FTimerHandle TimerHandle;
+
+	/** Time the timer is currently set to fire at */
+	double TimerExpirationTime = 0.0;
+
+	double GetTime() const;
+
+	void OnAbilityCommitted(UGameplayAbility* InAbility);
+	void OnGameplayEffectRemoved(const FActiveGameplayEffect& InEffectRemoved);
+
+	/** Pops every expired entry, ends (or re-queues) the matching cooldowns, and sets the timer for the next one */
+	void ProcessExpirations();
+
+	void EndCooldown(const FGameplayAbilitySpecHandle& InSpecHandle, const FCooldown& InCooldown) const;
+	void ScheduleTimer();
+};
@@ -0,0 +1,37 @@
+// Copyright 2021 Mickael Daniel. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Allocates ability spec InputIDs for input bindings, always handing out the lowest free one.
+ *
+ * IDs are released back when bindings are cleared or reset, so that they stay small and dense (suitable as array indices),
+ * and re-allocating the same bindings in the same order yields the same IDs. 0 is never allocated (invalid InputID).
+ */
+class GASCOMPANION_API FGSCInputIDAllocator
+{
+public:
+	/** Returns the lowest InputID not currently allocated */
+	int32 Allocate();
+
+	/** Releases a previously allocated InputID, so that it can be handed out again */
+	void Release(int32 InInputID);
+
+	/** Forgets about every allocated InputID */
+	void Reset();
+
+	/** Returns the number of currently allocated InputIDs */
+	int32 Num() const
+	{
+		return NextInputID - 1 - FreeInputIDs.Num();
+	}
+
+private:
+	/** Next InputID to allocate once the free list is empty */
+	int32 NextInputID = 1;
+
+	/** Min-heap of released InputIDs below NextInputID */
+	TArray<int32, TInlineAllocator<8>> FreeInputIDs;
+};
@@ -0,0 +1,138 @@
+// Copyright 2021 Mickael Daniel. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/StaticArray.h"
+#include "UObject/ObjectKey.h"
+
+class FOutputDevice;
+class UAbilitySystemComponent;
+class UGameplayAbility;
+
+/** Stages of an ability input event, from the input action trigger to the ability activation */
+enum class EGSCInputLatencyStage : uint8
+{
+	/** Input reached UGSCAbilitySystemComponent::AbilityLocalInputPressed */
+	AbilityInput,
+	/** Input was routed to the Combo Manager component */
+	ComboGating,
+	/** Failed activation was buffered by the Ability Queue component */
+	QueueGating,
+	/** Activation was attempted with TryActivateAbility */
+	ActivationRequested,
+	/** Ability activated locally (predicted on owning clients) */
+	Activated,
+	/** Server confirmed a predicted activation */
+	ServerConfirmed,
+
+	Num
+};
+
+GASCOMPANION_API const TCHAR* LexToString(EGSCInputLatencyStage InStage);
+
+/** Latency samples for a single stage, in milliseconds, bucketed in powers of two (<1ms, <2ms, <4ms ... >=256ms) */
+struct GASCOMPANION_API FGSCInputLatencyHistogram
+{
+	static constexpr int32 NumBuckets = 10;
+
+	TStaticArray<uint32, NumBuckets> Buckets;
+	uint32 Count = 0;
+	double MinMs = 0.0;
+	double MaxMs = 0.0;
+	double SumMs = 0.0;
+
+	FGSCInputLatencyHistogram();
+
+	void AddSample(double InLatencyMs);
+
+	double GetMeanMs() const
+	{
+		return Count > 0 ? SumMs / Count : 0.0;
+	}
+
+	/** Upper bound of the bucket holding the given percentile (0-1), clamped to the max recorded latency */
+	double GetPercentileMs(double InPercentile) const;
+
+	/** Upper bound of the bucket, in milliseconds (last bucket is unbounded) */
+	static double GetBucketUpperBoundMs(int32 InBucketIndex);
+};
+
+/**
+ * Measures ability input latency, from UGSCAbilityInputBindingComponent::OnAbilityInputPressed to the ability
+ * activation (and server confirmation for predicted activations), aggregated per ability class.
+ *
+ * Disabled by default, and enabled with the GASCompanion.InputLatency.Enabled console variable. Every entry point is a
+ * no-op when disabled. Results are printed with GASCompanion.InputLatency.Dump (optionally written to a CSV file in the
+ * profiling directory), and the activation / confirmation latencies are emitted as CSV profiler stats.
+ *
+ * Only the last input pressed is tracked per ASC. Timestamps of the intermediate stages are recorded once the input
+ * results in an activation, for the activated ability class. Inputs not activating anything within
+ * GASCompanion.InputLatency.MaxPendingTime are dropped.
+ *
+ * Uses FPlatformTime, so it works the same without a world (automation tests, dedicated servers).
+ */
+class GASCOMPANION_API FGSCInputLatencyTracker
+{
+public:
+	static FGSCInputLatencyTracker& Get();
+
+	/** Returns the value of GASCompanion.InputLatency.Enabled */
+	static bool IsEnabled();
+
+	/** Same as setting GASCompanion.InputLatency.Enabled. Pending input events are dropped when disabled. */
+	static void SetEnabled(bool bInEnabled);
+
+	/** Starts tracking a new input event for this ASC, replacing any pending one */
+	void BeginInput(const UAbilitySystemComponent* InASC, int32 InInputID);
+
+	/** Timestamps a stage of the pending input event for this ASC, if any */
+	void MarkStage(const UAbilitySystemComponent* InASC, EGSCInputLatencyStage InStage);
+
+	/**
+	 * Completes the pending input event for this ASC and records its stages for the ability class, if the activated spec
+	 * is bound to the pending input InputID.
+	 *
+	 * For predicted activations, the server confirmation is recorded once the activation prediction key is caught up.
+	 */
+	void OnAbilityActivated(const UAbilitySystemComponent* InASC, const UGameplayAbility* InAbility);
+
+	/** Adds a sample to the histogram of an ability class */
+	void RecordLatency(FName InAbilityClassName, EGSCInputLatencyStage InStage, double InLatencyMs);
+
+	/** Returns the histogram for an ability class and stage, or nullptr if no sample was recorded */
+	const FGSCInputLatencyHistogram* FindHistogram(FName InAbilityClassName, EGSCInputLatencyStage InStage) const;
+
+	/** Clears out recorded histograms and pending input events */
+	void Reset();
+
+	/** Prints recorded histograms, one line per ability class and stage */
+	void Dump(FOutputDevice& Ar) const;
+
+	/** Returns recorded histograms as CSV, one row per ability class and stage */
+	FString ToCSV() const;
+
+	/** Writes ToCSV() to the given file, returns whether it succeeded */
+	bool WriteCSV(const FString& InFilename) const;
+
+private:
+	struct FPendingInput
+	{
+		int32 InputID = INDEX_NONE;
+		double StartTime = 0.0;
+
+		/** Time of each stage since StartTime, in milliseconds (negative when stage was not reached) */
+		TStaticArray<double, static_cast<int32>(EGSCInputLatencyStage::Num)> StageLatencies;
+	};
+
+	using FStageHistograms = TStaticArray<FGSCInputLatencyHistogram, static_cast<int32>(EGSCInputLatencyStage::Num)>;
+
+	/** Last input event per ASC, not yet resulting in an activation */
+	TMap<FObjectKey, FPendingInput> PendingInputs;
+
+	/** Recorded histograms keyed by ability class name */
+	TMap<FName, FStageHistograms> Histograms;
+
+	/** Drops pending inputs older than MaxPendingTime */
+	void PrunePendingInputs(double InNow);
+};
@@ -27,6 +27,34 @@ enum class EGSCAbilityTriggerEvent : uint8
 	Triggered UMETA(DisplayName="Activate on Action Triggered (use with caution)"),
 };
 
+/** Groups of Ability System delegates UGSCCoreComponent subscribes to, used to build per net role delegate profiles */
+UENUM(BlueprintType, meta = (Bitflags, UseEnumValuesAsMaskValuesInEditor = "true"))
+enum class EGSCCoreComponentDelegates : uint8
+{
+	None = 0 UMETA(Hidden),
+
+	/** OnAttributeChange */
+	AttributeChanges = 1 << 0,
+
+	/** OnGameplayEffectAdded, OnGameplayEffectRemoved and OnGameplayEffectStackChange */
+	GameplayEffects = 1 << 1,
+
+	/** OnGameplayEffectTimeChange */
+	GameplayEffectTimes = 1 << 2,
+
+	/** OnGameplayTagChange */
+	GameplayTags = 1 << 3,
+
+	/** OnAbilityCommit */
+	AbilityCommits = 1 << 4,
+
+	/** OnCooldownStart and OnCooldownEnd */
+	Cooldowns = 1 << 5,
+
+	All = AttributeChanges | GameplayEffects | GameplayEffectTimes | GameplayTags | AbilityCommits | Cooldowns UMETA(Hidden),
+};
+ENUM_CLASS_FLAGS(EGSCCoreComponentDelegates);
+
 /**
 * Struct defining a list of gameplay effects, a tag, and targeting info
 *
@@ -84,3 +112,41 @@ public:
 	/** Adds new targets to target data */
 	void AddTargets(const TArray<FHitResult>& HitResults, const TArray<AActor*>& TargetActors);
 };
+
+/**
+ * Filter applied to generic gameplay tag change events (new or removed tags), before broadcasting them to Blueprints.
+ *
+ * A tag passes if it matches exactly one of ExactTags, or is (or is a child of) one of ParentTags. An empty filter lets
+ * every tag through. Results are cached per tag, so that rejecting a tag is a single hashed lookup.
+ */
+USTRUCT(BlueprintType)
+struct GASCOMPANION_API FGSCGameplayTagChangeFilter
+{
+	GENERATED_BODY()
+
+	/** Tags (and their children) to broadcast changes for */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "GameplayTagChangeFilter")
+	FGameplayTagContainer ParentTags;
+
+	/** Tags to broadcast changes for, matched exactly */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "GameplayTagChangeFilter")
+	FGameplayTagContainer ExactTags;
+
+	/** Returns true if the filter lets every tag through */
+	bool IsEmpty() const
+	{
+		return ParentTags.IsEmpty() && ExactTags.IsEmpty();
+	}
+
+	/** Returns whether changes to this tag should be broadcast */
+	bool Matches(const FGameplayTag& InTag) const;
+
+	/** Clears cached results, must be called whenever ParentTags or ExactTags are changed */
+	void ResetCache() const
+	{
+		CachedResults.Reset();
+	}
+
+private:
+	mutable TMap<FGameplayTag, bool> CachedResults;
+};
@@ -11,6 +11,8 @@
 /**
  * Use this notify state to open a combo window during witch the player can queue up the next combo by activating the ability again.
  *
+ * Only Begin / End are handled, next combo activation is resolved by UGSCComboManagerComponent when input or trigger notify happens.
+ *
  * Don't forget to set the `bEndCombo` property to true on this notifier if the montage is the last one of your combo chain.
  */
 UCLASS()
@@ -25,15 +27,12 @@ public:
 
 	virtual void NotifyBegin(USkeletalMeshComponent* MeshComp, UAnimSequenceBase* Animation, float TotalDuration) override;
 	virtual void NotifyEnd(USkeletalMeshComponent* MeshComp, UAnimSequenceBase* Animation) override;
-	virtual void NotifyTick(USkeletalMeshComponent* MeshComp, UAnimSequenceBase* Animation, float FrameDeltaTime) override;
 
 	virtual FString GetEditorComment() override;
 	virtual FString GetNotifyName_Implementation() const override;
 
 private:
-	// Used to check if the owner actor of this notify is the preview actor of Persona, in which case we don't do anything
+	// Returns null for the preview actor of Persona (editor preview world), in which case we don't do anything
 	// to prevent log warning when getting components via Companion interfaces
-	FString AnimationEditorPreviewActorString = "AnimationEditorPreviewActor";
-
 	AActor* GetOwnerActor(USkeletalMeshComponent* MeshComponent) const;
 };
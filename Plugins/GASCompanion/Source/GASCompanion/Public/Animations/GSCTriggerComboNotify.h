@@ -22,9 +22,7 @@ public:
 	virtual FString GetNotifyName_Implementation() const override;
 
 private:
-	// Used to check if the owner actor of this notify is the preview actor of Persona, in which case we don't do anything
+	// Returns null for the preview actor of Persona (editor preview world), in which case we don't do anything
 	// to prevent log warning when getting components via Companion interfaces
-	FString AnimationEditorPreviewActorString = "AnimationEditorPreviewActor";
-
 	AActor* GetOwnerActor(USkeletalMeshComponent* MeshComponent) const;
 };
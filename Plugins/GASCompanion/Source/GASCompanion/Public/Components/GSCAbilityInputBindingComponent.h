@@ -4,6 +4,7 @@
 
 #include "CoreMinimal.h"
 #include "GameplayAbilitySpec.h"
+#include "Abilities/GSCInputIDAllocator.h"
 #include "Abilities/GSCTypes.h"
 #include "Components/GSCPlayerControlsComponent.h"
 #include "GSCAbilityInputBindingComponent.generated.h"
@@ -68,6 +69,11 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category= "Player Controls", meta=(DisplayAfter="InputPriority", EditCondition = "TargetInputCancel != nullptr", EditConditionHides))
 	EGSCAbilityTriggerEvent TargetCancelTriggerEvent = EGSCAbilityTriggerEvent::Started;
 
+	//~ Begin UActorComponent interface
+	virtual void OnRegister() override;
+	virtual void OnUnregister() override;
+	//~ End UActorComponent interface
+
 	//~ Begin UPlayerControlsComponent interface
 	virtual void SetupPlayerControls_Implementation(UEnhancedInputComponent* PlayerInputComponent) override;
 	virtual void ReleaseInputComponent(AController* OldController) override;
@@ -142,18 +148,42 @@ private:
 	UPROPERTY(transient)
 	TMap<TObjectPtr<UInputAction>, FGSCAbilityInputBinding> MappedAbilities;
 
+	/** Reverse index of MappedAbilities, from binding InputID to Input Action */
+	UPROPERTY(transient)
+	TMap<int32, TObjectPtr<UInputAction>> InputActionsByInputID;
+
+	/** InputID of the binding each bound ability handle was last pushed to */
+	TMap<FGameplayAbilitySpecHandle, int32> InputIDsByAbilityHandle;
+
 	uint32 OnConfirmHandle = 0;
 	uint32 OnCancelHandle = 0;
 
+	/** Whether spec InputIDs need to be synced with mapped abilities before next input */
+	bool bBindingsDirty = true;
+
+	/** Bound to Companion ASC OnAbilitySpecsChangedDelegate. Without it (other ASCs), bindings are synced on every input. */
+	FDelegateHandle AbilitySpecsChangedHandle;
+
+	/** Used to allocate InputIDs when the ASC is not a Companion ASC (or not yet available) */
+	FGSCInputIDAllocator InputIDAllocator;
+
+	/** Returns the InputID allocator of the passed in ASC if it's a Companion ASC, or the one of this component otherwise */
+	FGSCInputIDAllocator& GetInputIDAllocator(UAbilitySystemComponent* InAbilitySystemComponent);
+
 	void ResetBindings();
 	void RunAbilitySystemSetup();
 
 	/**
-	 * Runs on press / release, and updates inputs ID for specs based on mapped abilities.
+	 * Updates inputs ID for specs based on mapped abilities.
 	 *
-	 * Needs to run everytime to handle the issue with lost inputID when playing as client after first PIE session if BP containing ASC is compiled in Editor. */
+	 * Needed to handle the issue with lost inputID when playing as client after first PIE session if BP containing ASC is compiled in Editor. */
 	void UpdateAbilitySystemBindings(UAbilitySystemComponent* AbilitySystemComponent);
 
+	/** Runs on press / release, calls UpdateAbilitySystemBindings only if specs changed since last sync */
+	void SyncAbilitySystemBindings();
+
+	void MarkBindingsDirty();
+
 	void OnAbilityInputPressed(UInputAction* InputAction);
 	void OnAbilityInputReleased(UInputAction* InputAction);
 	void OnLocalInputConfirm();
@@ -161,7 +191,14 @@ private:
 
 	void RemoveEntry(const UInputAction* InputAction);
 
+	/** Rebuilds InputActionsByInputID and InputIDsByAbilityHandle from MappedAbilities (after InputIDs were reassigned) */
+	void RebuildInputIDIndexes();
+
 	FGameplayAbilitySpec* FindAbilitySpec(FGameplayAbilitySpecHandle Handle) const;
+
+	/** Updates the spec InputID, and notifies the owning ASC so that its InputID index stays in sync */
+	static void SetAbilitySpecInputID(UAbilitySystemComponent* AbilitySystemComponent, FGameplayAbilitySpec& AbilitySpec, int32 InputID);
+
 	void TryBindAbilityInput(UInputAction* InputAction, FGSCAbilityInputBinding& AbilityInputBinding);
 
 	static ETriggerEvent GetInputActionTriggerEvent(EGSCAbilityTriggerEvent TriggerEvent);
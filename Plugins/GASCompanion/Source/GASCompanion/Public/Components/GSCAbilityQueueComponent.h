@@ -4,13 +4,53 @@
 
 #include "CoreMinimal.h"
 
+#include "GameplayAbilitySpec.h"
 #include "GameplayTagContainer.h"
 #include "Components/ActorComponent.h"
+#include "UObject/ObjectKey.h"
 #include "GSCAbilityQueueComponent.generated.h"
 
 class UAbilitySystemComponent;
 class UGameplayAbility;
 
+/** An ability activation request buffered by the Ability Queue, when activation failed within an opened queue window */
+USTRUCT()
+struct GASCOMPANION_API FGSCAbilityQueueRequest
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TObjectPtr<UGameplayAbility> Ability;
+
+	/** Spec the request is activated with, resolved once when queued */
+	FGameplayAbilitySpecHandle SpecHandle;
+
+	/**
+	 * InputID of the spec when queued. Specs granted without input binding carry INDEX_NONE (FGameplayAbilitySpec default),
+	 * which is also kept when no spec could be resolved for the ability.
+	 */
+	int32 InputID = INDEX_NONE;
+
+	/** World time the request was queued at */
+	double Timestamp = 0.0;
+};
+
+/** Ability Queue buffer counters, for tuning buffer size and expiry */
+struct FGSCAbilityQueueStats
+{
+	/** Buffered requests that were activated once the ability ended */
+	int32 Hits = 0;
+
+	/** Buffered requests discarded without activation (not allowed anymore, buffer resized, or failed to activate) */
+	int32 Misses = 0;
+
+	/** Buffered requests discarded in favor of another one (dropped from a full buffer, or an older request was activated) */
+	int32 Superseded = 0;
+
+	/** Buffered requests discarded for being older than AbilityQueueExpiry */
+	int32 Expired = 0;
+};
+
 /**
  * Actor Component responsible for Ability Queueing.
  *
@@ -35,6 +75,18 @@ public:
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "GAS Companion|Ability Queue System")
 	bool bAbilityQueueEnabled = true;
 
+	/**
+	 * How many activation requests can be buffered while the queue is opened. Oldest request is discarded when full.
+	 *
+	 * When the ability ends, the oldest buffered request that is still allowed (and not expired) is activated.
+	 */
+	UPROPERTY(EditAnywhere, Category = "GAS Companion|Ability Queue System", meta = (ClampMin = 1, ClampMax = 16))
+	int32 AbilityQueueBufferSize = 1;
+
+	/** Time in seconds after which a buffered request is discarded (0 to never expire) */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "GAS Companion|Ability Queue System", meta = (ClampMin = 0, Units = "s"))
+	float AbilityQueueExpiry = 0.f;
+
 	/** Setup GetOwner to character and sets references for ability system component and the owner itself. */
 	void SetupOwner();
 
@@ -62,8 +114,19 @@ public:
 
 	bool IsAllAbilitiesAllowedForAbilityQueue() const;
 
+	/** Returns the buffered ability that would be activated once the ability ends (oldest one still allowed and not expired), if any */
     const UGameplayAbility* GetCurrentQueuedAbility() const;
 
+	/** Returns whether the ability class is allowed to be queued, with the current queue settings */
+	bool IsAbilityAllowedForAbilityQueue(const UClass* InAbilityClass) const;
+
+	const FGSCAbilityQueueStats& GetAbilityQueueStats() const
+	{
+		return AbilityQueueStats;
+	}
+
+	void ResetAbilityQueueStats();
+
     TArray<TSubclassOf<UGameplayAbility>> GetQueuedAllowedAbilities() const;
 
 	/**
@@ -82,19 +145,49 @@ public:
 	void OnAbilityFailed(const UGameplayAbility* Ability, const FGameplayTagContainer& ReasonTags);
 
 protected:
-	// Called when the game starts
+	//~ Begin UActorComponent interface
 	virtual void BeginPlay() override;
+	virtual void OnRegister() override;
+	virtual void OnUnregister() override;
+	//~ End UActorComponent interface
 
 	/** Ability Queue System */
 
 	bool bAbilityQueueOpened = false;
 	bool bAllowAllAbilitiesForAbilityQueue = false;
 
+	/** Ring buffer of activation requests, sized to AbilityQueueBufferSize */
 	UPROPERTY()
-	TObjectPtr<UGameplayAbility> QueuedAbility;
-	
+	TArray<FGSCAbilityQueueRequest> QueuedRequests;
+
+	/** Position of the oldest request in QueuedRequests */
+	int32 QueuedRequestsHead = 0;
+
+	/** Number of buffered requests */
+	int32 QueuedRequestsNum = 0;
+
 	TArray<TSubclassOf<UGameplayAbility>> QueuedAllowedAbilities;
 
+	/** Hashed set of QueuedAllowedAbilities, for allowed checks */
+	TSet<TObjectKey<UClass>> QueuedAllowedAbilitiesSet;
+
+	FGSCAbilityQueueStats AbilityQueueStats;
+
+	/** Buffers the request, discarding the oldest one if the buffer is full */
+	void PushQueuedRequest(const FGSCAbilityQueueRequest& InRequest);
+
+	/** Activates the oldest buffered request still allowed and not expired, discarding the others */
+	void ActivateQueuedRequest();
+
+	/** Returns the offset from QueuedRequestsHead of the request ActivateQueuedRequest would activate, or INDEX_NONE */
+	int32 FindQueuedRequestToActivate(double InNow) const;
+
+	bool IsQueuedRequestExpired(const FGSCAbilityQueueRequest& InRequest, double InNow) const;
+
+	bool IsQueuedRequestAllowed(const FGSCAbilityQueueRequest& InRequest) const;
+
+	double GetWorldTime() const;
+
 	/**
 	* Reset all variables involved in the Ability Queue System to their original default values.
 	*/
@@ -12,6 +12,57 @@ class UAbilitySystemComponent;
 class UGSCGameplayAbility;
 class ACharacter;
 
+/**
+ * Combo state replicated to the owning client, bit-packed with a custom NetSerialize (packed combo index plus 4 bits for
+ * the window / trigger flags).
+ */
+USTRUCT()
+struct GASCOMPANION_API FGSCComboReplicatedState
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	int32 ComboIndex = 0;
+
+	UPROPERTY()
+	bool bComboWindowOpened = false;
+
+	UPROPERTY()
+	bool bShouldTriggerCombo = false;
+
+	UPROPERTY()
+	bool bRequestTriggerCombo = false;
+
+	UPROPERTY()
+	bool bNextComboAbilityActivated = false;
+
+	bool NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess);
+
+	bool operator==(const FGSCComboReplicatedState& Other) const
+	{
+		return ComboIndex == Other.ComboIndex
+			&& bComboWindowOpened == Other.bComboWindowOpened
+			&& bShouldTriggerCombo == Other.bShouldTriggerCombo
+			&& bRequestTriggerCombo == Other.bRequestTriggerCombo
+			&& bNextComboAbilityActivated == Other.bNextComboAbilityActivated;
+	}
+
+	bool operator!=(const FGSCComboReplicatedState& Other) const
+	{
+		return !(*this == Other);
+	}
+};
+
+template<>
+struct TStructOpsTypeTraits<FGSCComboReplicatedState> : public TStructOpsTypeTraitsBase2<FGSCComboReplicatedState>
+{
+	enum
+	{
+		WithNetSerializer = true,
+		WithIdenticalViaEquality = true,
+	};
+};
+
 UCLASS(BlueprintType, Blueprintable, ClassGroup=("GASCompanion"), meta=(BlueprintSpawnableComponent))
 class GASCOMPANION_API UGSCComboManagerComponent : public UActorComponent
 {
@@ -31,27 +82,28 @@ public:
 	/** Reference to GA_GSC_Melee_Base */
 	TSubclassOf<UGSCGameplayAbility> MeleeBaseAbility;
 
-	/** The combo index for the currently active combo */
+	/** The combo index for the currently active combo (replicated to simulated proxies on its own, owner gets it from ComboState) */
 	UPROPERTY(BlueprintReadOnly, Replicated, Category = "GAS Companion|Combo")
 	int32 ComboIndex = 0;
 
 	/** Whether or not the combo window is opened (eg. player can queue next combo within this window) */
-	UPROPERTY(BlueprintReadOnly, Replicated, Category = "GAS Companion|Combo")
+	UPROPERTY(BlueprintReadOnly, Category = "GAS Companion|Combo")
 	bool bComboWindowOpened = false;
 
 	/** Should we queue the next combo montage for the currently active combo */
-	UPROPERTY(BlueprintReadOnly, Replicated, Category = "GAS Companion|Combo")
+	UPROPERTY(BlueprintReadOnly, Category = "GAS Companion|Combo")
 	bool bShouldTriggerCombo = false;
 
 	/** Should we trigger the next combo montage */
-	UPROPERTY(BlueprintReadOnly, Replicated, Category = "GAS Companion|Combo")
+	UPROPERTY(BlueprintReadOnly, Category = "GAS Companion|Combo")
 	bool bRequestTriggerCombo = false;
 
 	/** Should we trigger the next combo montage */
-	UPROPERTY(BlueprintReadOnly, Replicated, Category = "GAS Companion|Combo")
+	UPROPERTY(BlueprintReadOnly, Category = "GAS Companion|Combo")
 	bool bNextComboAbilityActivated = false;
 
 	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
+	virtual void PreReplication(IRepChangedPropertyTracker& ChangedPropertyTracker) override;
 
 	/** Setup GetOwner to character and sets references for ability system component and the owner itself. */
 	void SetupOwner();
@@ -67,39 +119,100 @@ public:
 	UFUNCTION(BlueprintCallable, Category="GAS Companion|Combat")
 	void ResetCombo();
 
-	/** Part of the combo system, gate combo ability activation based on if character is already using the ability */
+	/**
+	 * Part of the combo system, gate combo ability activation based on if character is already using the ability.
+	 *
+	 * On locally controlled owning clients, the combo window is evaluated locally as well, and both combo start and next
+	 * combo are activated locally with prediction (confirmed or rejected by server through GAS).
+	 */
 	UFUNCTION(BlueprintCallable, Category="GAS Companion|Combat")
 	void ActivateComboAbility(TSubclassOf<UGSCGameplayAbility> AbilityClass, bool bAllowRemoteActivation = true);
 
 	void SetComboIndex(int32 InComboIndex);
 
+	/**
+	 * Called by combo abilities on activation. Increments the combo if the combo window is opened, in which case the next
+	 * combo is marked as activated for this window.
+	 *
+	 * For predicted next combo activations, the combo index is restored if server rejects it.
+	 */
+	void OnComboAbilityActivated(const FGameplayAbilityActivationInfo& ActivationInfo);
+
+	/** Restores the combo index from before a predicted next combo activation, when the server rejected it */
+	void OnPredictedComboRejected(int32 InPreviousComboIndex);
+
+	/** Returns true if next combo can be activated within the currently opened combo window */
+	bool CanActivateNextCombo() const;
+
+	/** Opens the combo window. Called on server and locally controlled owning client from UGSCComboWindowNotifyState. */
+	void OpenComboWindow(bool bInEndCombo);
+
+	/**
+	 * Closes the combo window, resetting the combo if next combo wasn't activated within it. Called on server and locally
+	 * controlled owning client from UGSCComboWindowNotifyState.
+	 */
+	void CloseComboWindow();
+
+	/**
+	 * Requests the next combo to be triggered. Called on server and locally controlled owning client from UGSCTriggerComboNotify.
+	 *
+	 * If player input was already registered within the combo window, next combo is activated right away. Otherwise, it is
+	 * activated as soon as input is registered (until the window closes).
+	 */
+	void RequestTriggerCombo();
+
 	/** Returns true if this component's actor has authority */
 	virtual bool IsOwnerActorAuthoritative() const;
 
+	/** Returns true if this component's actor is a locally controlled character */
+	bool IsOwnerLocallyControlled() const;
+
+	/** Returns true if combo window and trigger notifies are evaluated for this component (server and locally controlled owning client) */
+	bool CanEvaluateComboWindow() const;
+
 protected:
 	/** Cached value of rather this is a simulated actor */
 	UPROPERTY()
 	bool bCachedIsNetSimulated;
 
+	/** Packed combo state, only replicated to the owner. Updated from the individual properties in PreReplication. */
+	UPROPERTY(ReplicatedUsing = OnRep_ComboState)
+	FGSCComboReplicatedState ComboState;
+
+	UFUNCTION()
+	virtual void OnRep_ComboState();
+
+	/** Whether the currently opened combo window is the last one of the combo chain (no next combo) */
+	bool bComboWindowEndsCombo = false;
+
+	/** Number of predicted next combo activations not yet confirmed or rejected by server. Replicated combo index is ignored meanwhile. */
+	int32 PendingComboPredictions = 0;
+
+	void OnPredictedComboCaughtUp();
+
+	/**
+	 * Activates the next combo if the window is opened, player input was registered and trigger was requested.
+	 *
+	 * Evaluated whenever one of those changes, instead of every anim tick while the window is opened. Returns true if next combo was activated.
+	 *
+	 * On locally controlled owning clients, next combo activation is predicted.
+	 */
+	bool TryTriggerNextCombo();
+
 	//~Begin UActorComponent interface
 	virtual void BeginPlay() override;
 	virtual void OnRegister() override;
+	virtual void OnUnregister() override;
 	//~End UActorComponent interface
 
 	UFUNCTION(Server, Reliable)
 	void ServerActivateComboAbility(TSubclassOf<UGSCGameplayAbility> AbilityClass, bool bAllowRemoteActivation = true);
 
-	UFUNCTION(NetMulticast, Reliable)
-	void MulticastActivateComboAbility(TSubclassOf<UGSCGameplayAbility> AbilityClass, bool bAllowRemoteActivation = true);
-
 	void ActivateComboAbilityInternal(TSubclassOf<UGSCGameplayAbility> AbilityClass, bool bAllowRemoteActivation = true);
 
 	UFUNCTION(Server, Reliable)
 	void ServerSetComboIndex(int32 InComboIndex);
 
-	UFUNCTION(NetMulticast, Reliable)
-	void MulticastSetComboIndex(int32 InComboIndex);
-
 private:
 	/** Caches the flags that indicate whether this component has network authority. */
 	void CacheIsNetSimulated();
@@ -7,6 +7,7 @@
 #include "AttributeSet.h"
 #include "GameplayEffectTypes.h"
 #include "GameplayTagContainer.h"
+#include "Abilities/GSCTypes.h"
 #include "UI/GSCUWHud.h"
 #include "GSCCoreComponent.generated.h"
 
@@ -15,6 +16,7 @@ class UGameplayAbility;
 class UGameplayEffect;
 class UAbilitySystemComponent;
 class UGSCAttributeSetBase;
+class FGSCAttributeSetExecutionContext;
 struct FGameplayAbilitySpecHandle;
 
 /** Structure passed down to Actors Blueprint with PostGameplayEffectExecute Event */
@@ -91,7 +93,26 @@ public:
 	/** Setup GetOwner to character and sets references for ability system component and the owner itself. */
 	void SetupOwner();
 
-	/** Register Ability System delegates to mainly broadcast blueprint assignable event to BPs */
+	/**
+	 * Ability System delegates subscribed to when running on a dedicated server (Default is all).
+	 *
+	 * Cosmetic only events (effect times, tags, cooldowns) are typically not needed there.
+	 */
+	UPROPERTY(EditAnywhere, Category = "GAS Companion|Network", meta = (Bitmask, BitmaskEnum = "/Script/GASCompanion.EGSCCoreComponentDelegates"))
+	int32 DedicatedServerDelegates = static_cast<int32>(EGSCCoreComponentDelegates::All);
+
+	/**
+	 * Ability System delegates subscribed to when the owner is a simulated proxy (Default is all).
+	 *
+	 * Events driving authoritative gameplay logic (ability commits) are typically not needed there.
+	 */
+	UPROPERTY(EditAnywhere, Category = "GAS Companion|Network", meta = (Bitmask, BitmaskEnum = "/Script/GASCompanion.EGSCCoreComponentDelegates"))
+	int32 SimulatedProxyDelegates = static_cast<int32>(EGSCCoreComponentDelegates::All);
+
+	/** Returns the delegates profile matching the current net mode and owner role (all delegates for standalone, listen server, autonomous proxies) */
+	EGSCCoreComponentDelegates GetDelegatesForNetRole() const;
+
+	/** Register Ability System delegates to mainly broadcast blueprint assignable event to BPs, according to GetDelegatesForNetRole() */
 	void RegisterAbilitySystemDelegates(UAbilitySystemComponent* ASC);
 
 	/** Clean up any bound delegates to Ability System delegates */
@@ -174,6 +195,27 @@ public:
 	FGSCOnAttributeChange OnAttributeChange;
 
 
+	/**
+	 * When enabled, OnAttributeChange is no longer broadcast for every single change. Deltas are accumulated per attribute
+	 * (along with the merged source tags) and broadcast once per attribute at the end of the frame. (Default is false)
+	 *
+	 * Useful when periodic effects (regen) change attributes many times per frame, and listeners only care about the latest value.
+	 * OnHealthChange, OnStaminaChange, OnManaChange, OnDamage and OnDeath are not affected.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GAS Companion|Attributes")
+	bool bDeferAttributeChangeBroadcasts = false;
+
+	/** Attributes for which OnAttributeChange is always broadcast right away, even with bDeferAttributeChangeBroadcasts enabled */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GAS Companion|Attributes", meta = (EditCondition = "bDeferAttributeChangeBroadcasts"))
+	TArray<FGameplayAttribute> SynchronousAttributes;
+
+	/** Broadcasts OnAttributeChange right away for any deferred attribute change accumulated so far */
+	UFUNCTION(BlueprintCallable, Category = "GAS Companion|Attributes")
+	void FlushDeferredAttributeChanges();
+
+	// Attribute change callback bound to GSC ASC attribute change dispatcher, routing to OnAttributeChanged / OnDamageAttributeChanged
+	virtual void OnAnyAttributeChanged(const FOnAttributeChangeData& Data);
+
 	// Generic Attribute change callback for attributes
 	virtual void OnAttributeChanged(const FOnAttributeChangeData& Data);
 
@@ -277,6 +319,15 @@ public:
 	UFUNCTION(BlueprintCallable, Category="GAS Companion|Abilities")
 	TArray<UGameplayAbility*> GetActiveAbilitiesByClass(TSubclassOf<UGameplayAbility> AbilityToSearch) const;
 
+	/**
+	* Native, allocation free alternative to GetActiveAbilitiesByClass. Invokes the visitor for each active ability instance
+	* matching the given class, until the visitor returns false.
+	*/
+	void ForEachActiveAbilityOfClass(TSubclassOf<UGameplayAbility> AbilityToSearch, TFunctionRef<bool(UGameplayAbility*)> Visitor) const;
+
+	/** Returns the first active ability instance matching the given class, if any */
+	UGameplayAbility* GetFirstActiveAbilityByClass(TSubclassOf<UGameplayAbility> AbilityToSearch) const;
+
 	/**
 	* Returns a list of currently active ability instances that match the given tags
 	*
@@ -343,6 +394,14 @@ public:
 	virtual void PreAttributeChange(UGSCAttributeSetBase* AttributeSet, const FGameplayAttribute& Attribute, float NewValue);
 	virtual void PostGameplayEffectExecute(UGSCAttributeSetBase* AttributeSet, const FGameplayEffectModCallbackData& Data);
 
+	/**
+	 * Invoked by UGSCAttributeSetBase with the execution context it already resolved from the mod callback data.
+	 *
+	 * Broadcasts OnPostGameplayEffectExecute with the passed in context, or calls PostGameplayEffectExecute() instead when
+	 * bDispatchPostGameplayEffectExecute is set.
+	 */
+	virtual void PostGameplayEffectExecuteWithContext(UGSCAttributeSetBase* AttributeSet, const FGSCAttributeSetExecutionContext& ExecutionContext);
+
 	/**
 	* PostGameplayEffectExecute event fired off from native AttributeSets, define here
 	* any attribute change specific management you are not doing in c++ (like clamp)
@@ -425,10 +484,54 @@ public:
 	UPROPERTY(BlueprintAssignable, Category="GAS Companion|Ability")
 	FGSCOnGameplayEffectRemoved OnGameplayEffectRemoved;
 
+	/**
+	 * When enabled, GameplayEffect events above (added, removed, stack and time change) are only broadcast for effects whose
+	 * asset or granted tags match at least one of the GameplayEffectEventQueries, or one of the queries registered with
+	 * SubscribeToGameplayEffectEvents(). (Default is false)
+	 *
+	 * Stack / time change delegates are only bound on matching effects, and tags are not extracted again for other effects.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GAS Companion|Ability")
+	bool bFilterGameplayEffectEvents = false;
+
+	/** Tag queries always subscribed to, when bFilterGameplayEffectEvents is enabled */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GAS Companion|Ability", meta = (EditCondition = "bFilterGameplayEffectEvents"))
+	TArray<FGameplayTagQuery> GameplayEffectEventQueries;
+
+	/**
+	 * Registers a tag query GameplayEffect events should be broadcast for, when bFilterGameplayEffectEvents is enabled.
+	 *
+	 * Only applies to effects added after the subscription.
+	 *
+	 * @return Handle to pass to UnsubscribeFromGameplayEffectEvents()
+	 */
+	UFUNCTION(BlueprintCallable, Category = "GAS Companion|Ability")
+	int32 SubscribeToGameplayEffectEvents(const FGameplayTagQuery& Query);
+
+	/** Removes a tag query previously registered with SubscribeToGameplayEffectEvents() */
+	UFUNCTION(BlueprintCallable, Category = "GAS Companion|Ability")
+	void UnsubscribeFromGameplayEffectEvents(int32 SubscriptionHandle);
+
 	/** Called whenever a tag is added or removed (but not if just count is increased. Only for 'new' and 'removed' events) */
 	UPROPERTY(BlueprintAssignable, Category="GAS Companion|Ability")
 	FGSCOnGameplayTagStackChange OnGameplayTagChange;
 
+	/**
+	 * Whether OnGameplayTagChange is broadcast at all. When disabled, no generic tag listener is installed on the ASC. (Default is true)
+	 *
+	 * Takes effect the next time Ability System delegates are registered (InitAbilityActorInfo).
+	 */
+	UPROPERTY(EditAnywhere, Category = "GAS Companion|Ability")
+	bool bBroadcastGameplayTagChanges = true;
+
+	/** Restricts OnGameplayTagChange to the tags matching this filter. An empty filter broadcasts changes for every tag. */
+	UPROPERTY(EditAnywhere, Category = "GAS Companion|Ability", meta = (EditCondition = "bBroadcastGameplayTagChanges"))
+	FGSCGameplayTagChangeFilter GameplayTagChangeFilter;
+
+	/** Updates the tags OnGameplayTagChange is broadcast for */
+	UFUNCTION(BlueprintCallable, Category = "GAS Companion|Ability")
+	void SetGameplayTagChangeFilter(const FGSCGameplayTagChangeFilter& InFilter);
+
 	/** Called whenever an ability is committed (cost / cooldown are applied) */
 	UPROPERTY(BlueprintAssignable, Category="GAS Companion|Ability")
 	FGSCOnAbilityCommit OnAbilityCommit;
@@ -442,8 +545,19 @@ public:
 	FGSCOnCooldownEnd OnCooldownEnd;
 
 protected:
+	/**
+	 * Whether PostGameplayEffectExecuteWithContext() calls PostGameplayEffectExecute(), which resolves the execution context
+	 * again from the mod callback data.
+	 *
+	 * Enabled for native subclasses, which may still override PostGameplayEffectExecute(). Native subclasses not overriding
+	 * it should disable it in their constructor.
+	 */
+	bool bDispatchPostGameplayEffectExecute = false;
+
 	//~ Begin UActorComponent interface
 	virtual void BeginPlay() override;
+	virtual void OnRegister() override;
+	virtual void OnUnregister() override;
 	//~ End UActorComponent interface
 
 	//~ Begin UObject interface
@@ -452,9 +566,15 @@ protected:
 
     bool bStartupAbilitiesGranted = false;
 
+	/** Delegates subscribed to during the last RegisterAbilitySystemDelegates */
+	EGSCCoreComponentDelegates RegisteredDelegates = EGSCCoreComponentDelegates::All;
+
 	/** Triggered by ASC when GEs are added */
 	virtual void OnActiveGameplayEffectAdded(UAbilitySystemComponent* Target, const FGameplayEffectSpec& SpecApplied, FActiveGameplayEffectHandle ActiveHandle);
 
+	/** Returns whether events should be broadcast for an effect with these tags, see bFilterGameplayEffectEvents */
+	bool MatchesGameplayEffectEventQueries(const FGameplayTagContainer& AssetTags, const FGameplayTagContainer& GrantedTags) const;
+
 	/** Triggered by ASC when GEs stack count changes */
 	virtual void OnActiveGameplayEffectStackChanged(FActiveGameplayEffectHandle ActiveHandle, int32 NewStackCount, int32 PreviousStackCount);
 
@@ -473,13 +593,43 @@ protected:
 	/** Trigger by ASC when a cooldown tag is changed (new or removed)  */
 	virtual void OnCooldownGameplayTagChanged(const FGameplayTag GameplayTag, int32 NewCount, FGameplayAbilitySpecHandle AbilitySpecHandle, float Duration);
 
-	/** Manage cooldown events trigger when an ability is committed */
+	/** Manage cooldown events trigger when an ability is committed (only for ASCs that are not GSC ASCs, which track cooldowns themselves) */
 	void HandleCooldownOnAbilityCommit(UGameplayAbility* ActivatedAbility);
 
+	/** Triggered by GSC ASC cooldown tracker when a committed ability applied a cooldown */
+	void OnTrackedCooldownStart(UGameplayAbility* Ability, const FGameplayTagContainer& CooldownTags, float TimeRemaining, float Duration);
+
+	/** Triggered by GSC ASC cooldown tracker when a cooldown expired */
+	void OnTrackedCooldownEnd(UGameplayAbility* Ability, const FGameplayTag& CooldownTag, float Duration);
+
 private:
-	/** Array of active GE handle bound to delegates that will be fired when the count for the key tag changes to or away from zero */
-	TArray<FActiveGameplayEffectHandle> GameplayEffectAddedHandles;
+	/** Attribute change accumulated for the current frame, when bDeferAttributeChangeBroadcasts is enabled */
+	struct FGSCDeferredAttributeChange
+	{
+		FGameplayAttribute Attribute;
+		float DeltaValue = 0.f;
+		FGameplayTagContainer SourceTags;
+	};
+
+	/** Pending changes, in the order attributes first changed during the frame */
+	TArray<FGSCDeferredAttributeChange, TInlineAllocator<4>> DeferredAttributeChanges;
+
+	/** Bound to end of frame only while there are pending changes */
+	FDelegateHandle DeferredAttributeChangesHandle;
+
+	void DeferAttributeChange(const FGameplayAttribute& Attribute, float DeltaValue, const FGameplayTagContainer& SourceTags);
+	void ResetDeferredAttributeChanges();
+
+	/** Set of active GE handles bound to stack / time change delegates, pruned as effects are removed */
+	TSet<FActiveGameplayEffectHandle> GameplayEffectAddedHandles;
+
+	/** Tag queries registered with SubscribeToGameplayEffectEvents() */
+	TMap<int32, FGameplayTagQuery> GameplayEffectEventSubscriptions;
+
+	int32 LastGameplayEffectEventSubscription = 0;
 
 	/** Array of tags bound to delegates that will be fired when the count for the key tag changes to or away from zero */
 	TArray<FGameplayTag> GameplayTagBoundToDelegates;
+
+	void BroadcastPostGameplayEffectExecute(UGSCAttributeSetBase* AttributeSet, const FGSCAttributeSetExecutionContext& ExecutionContext) const;
 };
@@ -0,0 +1,22 @@
+// Copyright 2021 Mickael Daniel. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Stats/Stats.h"
+
+// Use "stat GASCompanion" to display those in game
+
+DECLARE_STATS_GROUP(TEXT("GAS Companion"), STATGROUP_GASCompanion, STATCAT_Advanced);
+
+// Attribute Sets instantiated when granting attributes (ASC defaults, Ability Sets and Game Feature actions)
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Attribute Sets Allocated"), STAT_GSC_AttributeSetsAllocated, STATGROUP_GASCompanion, GASCOMPANION_API);
+
+// Attribute Sets reset in place on respawn instead of being reallocated (bPoolAttributeSetsOnSpawn)
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Attribute Sets Reused"), STAT_GSC_AttributeSetsReused, STATGROUP_GASCompanion, GASCOMPANION_API);
+
+// Active Gameplay Effect handles currently tracked by Core Components, should stay flat over long sessions
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Core Component Tracked Effect Handles"), STAT_GSC_CoreComponentEffectHandles, STATGROUP_GASCompanion, GASCOMPANION_API);
+
+// Active Gameplay Effect handles currently tracked by User Widgets, should stay flat over long sessions
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("User Widget Tracked Effect Handles"), STAT_GSC_UserWidgetEffectHandles, STATGROUP_GASCompanion, GASCOMPANION_API);
@@ -15,7 +15,7 @@ struct FGSCGameFeatureAbilityMapping
 	GENERATED_BODY()
 
 	/** Type of ability to grant */
-	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category=Ability)
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category=Ability, meta=(AssetBundles="AbilitySet"))
 	TSoftClassPtr<UGameplayAbility> AbilityType;
 
 	/** Level to grant the ability at */
@@ -23,7 +23,7 @@ struct FGSCGameFeatureAbilityMapping
 	int32 Level = 1;
 	
 	/** Input action to bind the ability to, if any (can be left unset) */
-	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category=Ability)
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category=Ability, meta=(AssetBundles="AbilitySet"))
 	TSoftObjectPtr<UInputAction> InputAction;
 
 	/** The enhanced input action event to use for ability activation */
@@ -40,11 +40,11 @@ struct FGSCGameFeatureAttributeSetMapping
 	GENERATED_BODY()
 
 	/** Attribute Set to grant */
-	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category=Attributes)
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category=Attributes, meta=(AssetBundles="AbilitySet"))
 	TSoftClassPtr<UAttributeSet> AttributeSet;
 
 	/** Data table referent to initialize the attributes with, if any (can be left unset) */
-	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category=Attributes, meta = (RequiredAssetDataTags = "RowStructure=/Script/GameplayAbilities.AttributeMetaData"))
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category=Attributes, meta = (RequiredAssetDataTags = "RowStructure=/Script/GameplayAbilities.AttributeMetaData", AssetBundles="AbilitySet"))
 	TSoftObjectPtr<UDataTable> InitializationData;
 
 	/** Default constructor */
@@ -57,7 +57,7 @@ struct FGSCGameFeatureGameplayEffectMapping
 	GENERATED_BODY()
 
 	/** Gameplay Effect to apply */
-	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Gameplay Effect")
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Gameplay Effect", meta=(AssetBundles="AbilitySet"))
 	TSoftClassPtr<UGameplayEffect> EffectType;
 
 	/** Level for the Gameplay Effect to apply */
@@ -0,0 +1,57 @@
+// Copyright 2021 Mickael Daniel. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "GSCComponentRegistrySubsystem.generated.h"
+
+class UActorComponent;
+
+/**
+ * World Subsystem keeping track of GAS Companion components per owning actor.
+ *
+ * Components register themselves in OnRegister / OnUnregister, which covers components added or removed at runtime
+ * by Game Features as well as components destroyed along with their owner. This lets the Blueprint Function Library
+ * getters resolve a component with a single map lookup instead of walking the actor's whole component list.
+ */
+UCLASS(DisplayName = "GSC Component Registry")
+class GASCOMPANION_API UGSCComponentRegistrySubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	//~ Begin USubsystem interface
+	virtual void Deinitialize() override;
+	//~ End USubsystem interface
+
+	/** Adds the component to its owner's entry, in the registry of the world it belongs to (if any) */
+	static void RegisterComponent(UActorComponent* InComponent);
+
+	/** Removes the component from its owner's entry, in the registry of the world it belongs to (if any) */
+	static void UnregisterComponent(UActorComponent* InComponent);
+
+	/**
+	 * Returns the first component of the given type registered for this actor.
+	 *
+	 * Falls back to a regular FindComponentByClass when the actor's world doesn't have a registry (eg. editor preview worlds),
+	 * or when no matching component is registered for the actor (not registered yet, or registration skipped).
+	 */
+	static UActorComponent* FindComponentForActor(const AActor* InActor, const TSubclassOf<UActorComponent> InComponentClass);
+
+	template <class T>
+	static T* FindComponentForActor(const AActor* InActor)
+	{
+		static_assert(TPointerIsConvertibleFromTo<T, const UActorComponent>::Value, "'T' template parameter to FindComponentForActor must be derived from UActorComponent");
+		return static_cast<T*>(FindComponentForActor(InActor, T::StaticClass()));
+	}
+
+private:
+	/** Few components are tracked per actor, inline allocation avoids a heap allocation per registered actor */
+	using FGSCRegisteredComponents = TArray<TWeakObjectPtr<UActorComponent>, TInlineAllocator<4>>;
+
+	TMap<TObjectKey<AActor>, FGSCRegisteredComponents> RegisteredComponents;
+
+	static UGSCComponentRegistrySubsystem* GetRegistryForComponent(const UActorComponent* InComponent);
+};
@@ -23,6 +23,9 @@ class UTextBlock;
  *
  * The other main difference with UGSCUserWidget is that this class also defines widget optional binding for
  * Health / Stamina / Mana attributes from UGSCAttributeSet.
+ *
+ * Attribute changes are cached and applied to the bound widgets from tick, at most once per frame (or every
+ * AttributeRefreshInterval), and texts are only rebuilt when the displayed integer values change.
  */
 UCLASS()
 class GASCOMPANION_API UGSCUWHud : public UGSCUserWidget
@@ -38,6 +41,14 @@ protected:
 	
 public:
 
+	/**
+	 * Minimum time in seconds between two updates of the Health / Stamina / Mana widgets on attribute changes.
+	 *
+	 * 0 updates them at most once per frame.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="GAS Companion|UI", meta=(ClampMin=0, Units="s"))
+	float AttributeRefreshInterval = 0.f;
+
 	/** Init widget with attributes from owner character **/
 	UFUNCTION(BlueprintCallable, Category="GAS Companion|UI")
 	virtual void InitFromCharacter();
@@ -101,11 +112,55 @@ protected:
 	UPROPERTY(BlueprintReadOnly, meta = (BindWidgetOptional), Category = "GAS Companion|UI")
 	TObjectPtr<UProgressBar> ManaProgressBar;
 
-	/** Updates bound widget whenever one of the attribute we care about is changed */
+	/** Caches the new value whenever one of the attribute we care about is changed, bound widgets are updated on next refresh */
 	virtual void HandleAttributeChange(FGameplayAttribute Attribute, float NewValue, float OldValue) override;
 
+	/** Updates bound widgets for the attributes changed since last refresh, through SetHealth / SetMaxHealth and so on */
+	virtual void RefreshAttributeWidgets();
+
 
 private:
+	/** Last known values of an attribute and its max attribute, along with the values its text was built with */
+	struct FAttributeDisplay
+	{
+		float Value = 0.f;
+		float MaxValue = 0.f;
+		bool bHasValue = false;
+		bool bHasMaxValue = false;
+
+		/** Changed since last refresh */
+		bool bValueDirty = false;
+		bool bMaxValueDirty = false;
+
+		/** Floored values currently displayed by the bound text */
+		int32 TextValue = 0;
+		int32 TextMaxValue = 0;
+		bool bHasText = false;
+
+		void SetValue(const float InValue)
+		{
+			Value = InValue;
+			bHasValue = true;
+			bValueDirty = false;
+		}
+
+		void SetMaxValue(const float InMaxValue)
+		{
+			MaxValue = InMaxValue;
+			bHasMaxValue = true;
+			bMaxValueDirty = false;
+		}
+	};
+
+	FAttributeDisplay HealthDisplay;
+	FAttributeDisplay StaminaDisplay;
+	FAttributeDisplay ManaDisplay;
+
+	/** Set when an attribute display changed since last refresh */
+	bool bAttributeWidgetsDirty = false;
+
+	float TimeSinceAttributeRefresh = 0.f;
+
 	/** Array of active GE handle bound to delegates that will be fired when the count for the key tag changes to or away from zero */
 	TArray<FActiveGameplayEffectHandle> GameplayEffectAddedHandles;
 
@@ -114,6 +169,16 @@ private:
 
 	static FString GetAttributeFormatString(float BaseValue, float MaxValue);
 
+	/** Returns the cached value of the display, reading it from the ASC if not known yet */
+	float GetDisplayValue(FAttributeDisplay& InDisplay, const FGameplayAttribute& InAttribute) const;
+	float GetDisplayMaxValue(FAttributeDisplay& InDisplay, const FGameplayAttribute& InMaxAttribute) const;
+
+	/** Rebuilds the text from the display values, unless their floored values are the ones already displayed */
+	static void UpdateAttributeText(UTextBlock* InTextBlock, FAttributeDisplay& InDisplay);
+
+	/** Marks the display dirty with the new value (or max value) */
+	void MarkAttributeDisplayDirty(FAttributeDisplay& InDisplay, float InNewValue, bool bInMaxValue);
+
 	/**
 	 * Checks owner for a valid ASC and kick in initialization logic if it finds one
 	 *
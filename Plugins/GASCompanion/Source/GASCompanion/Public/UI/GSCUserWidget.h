@@ -7,6 +7,7 @@
 #include "AttributeSet.h"
 #include "GameplayAbilitySpec.h"
 #include "GameplayEffectTypes.h"
+#include "Abilities/GSCTypes.h"
 #include "GSCUserWidget.generated.h"
 
 class UGSCCoreComponent;
@@ -68,6 +69,22 @@ public:
 
 	UPROPERTY(BlueprintReadOnly, Category="GAS Companion|UI", meta=(DeprecatedFunction, DeprecationMessage="Use GetOwningCoreComponent() instead."))
 	TObjectPtr<UGSCCoreComponent> OwnerCoreComponent;
+
+	/**
+	 * Whether OnGameplayTagChange is triggered at all. When disabled, no generic tag listener is installed on the ASC. (Default is true)
+	 *
+	 * Takes effect the next time Ability System delegates are registered.
+	 */
+	UPROPERTY(EditAnywhere, Category="GAS Companion|UI")
+	bool bBroadcastGameplayTagChanges = true;
+
+	/** Restricts OnGameplayTagChange to the tags matching this filter. An empty filter triggers it for every tag. */
+	UPROPERTY(EditAnywhere, Category="GAS Companion|UI", meta=(EditCondition="bBroadcastGameplayTagChanges"))
+	FGSCGameplayTagChangeFilter GameplayTagChangeFilter;
+
+	/** Updates the tags OnGameplayTagChange is triggered for */
+	UFUNCTION(BlueprintCallable, Category="GAS Companion|UI")
+	void SetGameplayTagChangeFilter(const FGSCGameplayTagChangeFilter& InFilter);
 	
 	/** Initialize or update references to owner actor and additional actor components (such as AbilitySystemComponent) and cache them for this instance of user widget. */
 	UFUNCTION(BlueprintCallable, Category="GAS Companion|UI")
@@ -97,6 +114,10 @@ public:
 
 	/** Clears off any ASC delegates and dispose AbilitySystemComponent pointer */
 	void ResetAbilitySystem();
+
+	//~ Begin UObject interface
+	virtual void BeginDestroy() override;
+	//~ End UObject interface
 	
 	/** Register listeners for AbilitySystemComponent (Attributes, GameplayEffects / Tags, Cooldowns, ...) */
 	virtual void RegisterAbilitySystemDelegates();
@@ -176,6 +197,12 @@ public:
 	/** Trigger by ASC when a cooldown tag is changed (new or removed)  */
 	virtual void OnCooldownGameplayTagChanged(const FGameplayTag GameplayTag, int32 NewCount, FGameplayAbilitySpecHandle AbilitySpecHandle, float Duration);
 
+	/** Triggered by GSC ASC cooldown tracker when a committed ability applied a cooldown */
+	virtual void OnTrackedCooldownStart(UGameplayAbility* Ability, const FGameplayTagContainer& CooldownTags, float TimeRemaining, float Duration);
+
+	/** Triggered by GSC ASC cooldown tracker when a cooldown expired */
+	virtual void OnTrackedCooldownEnd(UGameplayAbility* Ability, const FGameplayTag& CooldownTag, float Duration);
+
 	/** Post attribute change hook for subclass that needs further handling */
 	virtual void HandleAttributeChange(FGameplayAttribute Attribute, float NewValue, float OldValue) {}
 
@@ -209,8 +236,11 @@ protected:
 	
 private:
 	
-	/** Array of active GE handle bound to delegates that will be fired when the count for the key tag changes to or away from zero */
-	TArray<FActiveGameplayEffectHandle> GameplayEffectAddedHandles;
+	/** Set of active GE handles bound to stack / time change delegates, pruned as effects are removed */
+	TSet<FActiveGameplayEffectHandle> GameplayEffectAddedHandles;
+
+	/** Forgets about all tracked GE handles, once delegates have been unbound */
+	void ResetGameplayEffectAddedHandles();
 
 	/** Array of tags bound to delegates that will be fired when the count for the key tag changes to or away from zero */
 	TArray<FGameplayTag> GameplayTagBoundToDelegates;
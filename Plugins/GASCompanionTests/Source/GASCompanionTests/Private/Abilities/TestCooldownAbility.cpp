@@ -0,0 +1,79 @@
+// Copyright 2021-2022 Mickael Daniel. All Rights Reserved.
+
+
+#include "Abilities/TestCooldownAbility.h"
+#include "AbilitySystemComponent.h"
+#include "GameplayEffect.h"
+#include "GASCompanionTestsNativeTags.h"
+#include "Engine/World.h"
+
+UTestCooldownAbility::UTestCooldownAbility()
+{
+	InstancingPolicy = EGameplayAbilityInstancingPolicy::InstancedPerActor;
+
+	// Only checked for presence, cooldown itself is applied in ApplyCooldown
+	CooldownGameplayEffectClass = UGameplayEffect::StaticClass();
+}
+
+const FGameplayTagContainer* UTestCooldownAbility::GetCooldownTags() const
+{
+	if (TestCooldownTags.IsEmpty())
+	{
+		TestCooldownTags.AddTag(GetTestCooldownTag());
+	}
+
+	return &TestCooldownTags;
+}
+
+void UTestCooldownAbility::ApplyCooldown(const FGameplayAbilitySpecHandle Handle, const FGameplayAbilityActorInfo* ActorInfo, const FGameplayAbilityActivationInfo ActivationInfo) const
+{
+	UAbilitySystemComponent* ASC = ActorInfo ? ActorInfo->AbilitySystemComponent.Get() : nullptr;
+	if (!ASC)
+	{
+		return;
+	}
+
+	ASC->AddLooseGameplayTags(*GetCooldownTags());
+	CooldownStartTime = ASC->GetWorld()->GetTimeSeconds();
+}
+
+void UTestCooldownAbility::GetCooldownTimeRemainingAndDuration(FGameplayAbilitySpecHandle Handle, const FGameplayAbilityActorInfo* ActorInfo, float& TimeRemaining, float& CooldownDuration) const
+{
+	TimeRemaining = 0.f;
+	CooldownDuration = 0.f;
+
+	const UAbilitySystemComponent* ASC = ActorInfo ? ActorInfo->AbilitySystemComponent.Get() : nullptr;
+	if (!ASC || !ASC->HasAnyMatchingGameplayTags(*GetCooldownTags()))
+	{
+		return;
+	}
+
+	TimeRemaining = FMath::Max(static_cast<float>(CooldownStartTime + TestCooldownDuration - ASC->GetWorld()->GetTimeSeconds()), 0.f);
+	CooldownDuration = TestCooldownDuration;
+}
+
+void UTestCooldownAbility::ActivateAbility(const FGameplayAbilitySpecHandle Handle, const FGameplayAbilityActorInfo* ActorInfo, const FGameplayAbilityActivationInfo ActivationInfo, const FGameplayEventData* TriggerEventData)
+{
+	const bool bCommitted = CommitAbility(Handle, ActorInfo, ActivationInfo);
+	EndAbility(Handle, ActorInfo, ActivationInfo, true, !bCommitted);
+}
+
+UTestCooldownAbility_01::UTestCooldownAbility_01()
+{
+	TestCooldownDuration = 0.1f;
+}
+
+FGameplayTag UTestCooldownAbility_01::GetTestCooldownTag() const
+{
+	return FGASCompanionTestsNativeTags::Get().CooldownTest_01;
+}
+
+UTestCooldownAbility_02::UTestCooldownAbility_02()
+{
+	TestCooldownDuration = 0.3f;
+}
+
+FGameplayTag UTestCooldownAbility_02::GetTestCooldownTag() const
+{
+	return FGASCompanionTestsNativeTags::Get().CooldownTest_02;
+}
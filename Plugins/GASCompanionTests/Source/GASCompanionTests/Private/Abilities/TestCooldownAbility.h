@@ -0,0 +1,64 @@
+// Copyright 2021-2022 Mickael Daniel. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Abilities/GameplayAbility.h"
+#include "TestCooldownAbility.generated.h"
+
+/**
+ * Ability committing a cooldown on activation, applied as loose tags instead of a gameplay effect.
+ *
+ * Removing the tags doesn't go through OnAnyGameplayEffectRemovedDelegate, so that cooldown ends are only picked up
+ * by the cooldown tracker timer.
+ */
+UCLASS()
+class UTestCooldownAbility : public UGameplayAbility
+{
+	GENERATED_BODY()
+
+public:
+	UTestCooldownAbility();
+
+	virtual const FGameplayTagContainer* GetCooldownTags() const override;
+	virtual void ApplyCooldown(const FGameplayAbilitySpecHandle Handle, const FGameplayAbilityActorInfo* ActorInfo, const FGameplayAbilityActivationInfo ActivationInfo) const override;
+	virtual void GetCooldownTimeRemainingAndDuration(FGameplayAbilitySpecHandle Handle, const FGameplayAbilityActorInfo* ActorInfo, float& TimeRemaining, float& CooldownDuration) const override;
+	virtual void ActivateAbility(const FGameplayAbilitySpecHandle Handle, const FGameplayAbilityActorInfo* ActorInfo, const FGameplayAbilityActivationInfo ActivationInfo, const FGameplayEventData* TriggerEventData) override;
+
+protected:
+	float TestCooldownDuration = 0.f;
+
+	/** Native tags aren't registered yet when CDOs are constructed, cooldown tags are gathered on first use */
+	virtual FGameplayTag GetTestCooldownTag() const
+	{
+		return FGameplayTag();
+	}
+
+	mutable FGameplayTagContainer TestCooldownTags;
+
+	mutable double CooldownStartTime = 0.0;
+};
+
+UCLASS()
+class UTestCooldownAbility_01 : public UTestCooldownAbility
+{
+	GENERATED_BODY()
+
+public:
+	UTestCooldownAbility_01();
+
+protected:
+	virtual FGameplayTag GetTestCooldownTag() const override;
+};
+
+UCLASS()
+class UTestCooldownAbility_02 : public UTestCooldownAbility
+{
+	GENERATED_BODY()
+
+public:
+	UTestCooldownAbility_02();
+
+protected:
+	virtual FGameplayTag GetTestCooldownTag() const override;
+};
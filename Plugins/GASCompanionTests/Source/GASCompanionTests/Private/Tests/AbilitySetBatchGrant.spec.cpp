@@ -0,0 +1,154 @@
+﻿// Copyright 2021-2022 Mickael Daniel. All Rights Reserved.
+
+#include "Abilities/GSCAbilitySet.h"
+#include "Abilities/GSCAbilitySystemComponent.h"
+#include "Abilities/GSCGameplayAbility.h"
+#include "Abilities/Attributes/GSCAttributeSet.h"
+#include "Engine/World.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/AutomationTest.h"
+#include "ModularGameplayActors/GSCModularCharacter.h"
+#include "Utils/GASCompanionTestsUtils.h"
+
+BEGIN_DEFINE_SPEC(FGSCAbilitySetBatchGrantSpec, "GASCompanion.Runtime", EAutomationTestFlags::ProductFilter | EAutomationTestFlags::ApplicationContextMask)
+	static constexpr int32 NumActors = 40;
+
+	UWorld* World = nullptr;
+	uint64 InitialFrameCounter = 0;
+	UGSCAbilitySet* AbilitySetFixture = nullptr;
+
+	TArray<AGSCModularCharacter*> Actors;
+	TArray<UAbilitySystemComponent*> ASCs;
+
+	void SpawnActors(TArray<AGSCModularCharacter*>& OutActors, TArray<UAbilitySystemComponent*>& OutASCs) const;
+END_DEFINE_SPEC(FGSCAbilitySetBatchGrantSpec)
+
+void FGSCAbilitySetBatchGrantSpec::SpawnActors(TArray<AGSCModularCharacter*>& OutActors, TArray<UAbilitySystemComponent*>& OutASCs) const
+{
+	for (int32 Index = 0; Index < NumActors; ++Index)
+	{
+		AGSCModularCharacter* Actor = World->SpawnActor<AGSCModularCharacter>();
+		OutActors.Add(Actor);
+		OutASCs.Add(Actor->GetAbilitySystemComponent());
+	}
+}
+
+void FGSCAbilitySetBatchGrantSpec::Define()
+{
+	BeforeEach([this]()
+	{
+		AddInfo(TEXT("Before Each ..."));
+
+		// Setup tests
+		World = FGASCompanionTestsUtils::CreateWorld(InitialFrameCounter);
+
+		AbilitySetFixture = NewObject<UGSCAbilitySet>(GetTransientPackage(), TEXT("AbilitySetFixture"));
+
+		FGSCGameFeatureAbilityMapping AbilityMapping;
+		AbilityMapping.AbilityType = UGSCGameplayAbility::StaticClass();
+		AbilitySetFixture->GrantedAbilities.Add(AbilityMapping);
+
+		FGSCGameFeatureAttributeSetMapping AttributeSetMapping;
+		AttributeSetMapping.AttributeSet = UGSCAttributeSet::StaticClass();
+		AttributeSetMapping.InitializationData = FGASCompanionTestsUtils::CreateAttributesDataTable();
+		AbilitySetFixture->GrantedAttributes.Add(AttributeSetMapping);
+
+		SpawnActors(Actors, ASCs);
+	});
+
+	Describe(TEXT("Ability Set batch grant"), [this]()
+	{
+		It(TEXT("Should grant the set to every ASC"), [this]()
+		{
+			TArray<FGSCAbilitySetHandle> Handles;
+			const bool bSuccess = AbilitySetFixture->GrantToAbilitySystems(ASCs, Handles);
+
+			TestTrue(TEXT("Ability Set granted to every ASC"), bSuccess);
+			TestEqual(TEXT("One handle per ASC"), Handles.Num(), ASCs.Num());
+
+			for (int32 Index = 0; Index < ASCs.Num(); ++Index)
+			{
+				const UAbilitySystemComponent* ASC = ASCs[Index];
+				TestTrue(FString::Printf(TEXT("Handle %d is valid"), Index), Handles[Index].IsValid());
+				TestTrue(FString::Printf(TEXT("ASC %d has the ability granted"), Index), ASC->FindAbilitySpecFromClass(UGSCGameplayAbility::StaticClass()) != nullptr);
+				TestEqual(FString::Printf(TEXT("ASC %d AttributeSet Health is initialized to 500.f"), Index), ASC->GetNumericAttributeBase(UGSCAttributeSet::GetHealthAttribute()), 500.f);
+			}
+
+			// Each ASC owns its own attribute set and ability spec
+			TestNotEqual(TEXT("Attribute Sets are not shared"), Handles[0].Attributes[0].Get(), Handles[1].Attributes[0].Get());
+			TestTrue(TEXT("Ability Spec Handles are unique"), Handles[0].Abilities[0] != Handles[1].Abilities[0]);
+		});
+
+		It(TEXT("Should leave handles of invalid ASCs invalid"), [this]()
+		{
+			TArray<UAbilitySystemComponent*> MixedASCs = { ASCs[0], nullptr, ASCs[1] };
+
+			TArray<FGSCAbilitySetHandle> Handles;
+			AddExpectedError(TEXT("is invalid or not a UGSCAbilitySystemComponent"));
+			const bool bSuccess = AbilitySetFixture->GrantToAbilitySystems(MixedASCs, Handles);
+
+			TestFalse(TEXT("Ability Set not granted to every ASC"), bSuccess);
+			TestEqual(TEXT("One handle per ASC"), Handles.Num(), MixedASCs.Num());
+			TestTrue(TEXT("First handle is valid"), Handles[0].IsValid());
+			TestFalse(TEXT("Handle of nullptr ASC is invalid"), Handles[1].IsValid());
+			TestTrue(TEXT("Last handle is valid"), Handles[2].IsValid());
+		});
+
+		It(TEXT("Should benchmark batch grant against per actor grant"), [this]()
+		{
+			TArray<AGSCModularCharacter*> PerActorActors;
+			TArray<UAbilitySystemComponent*> PerActorASCs;
+			SpawnActors(PerActorActors, PerActorASCs);
+
+			const double PerActorStartTime = FPlatformTime::Seconds();
+			for (UAbilitySystemComponent* ASC : PerActorASCs)
+			{
+				FGSCAbilitySetHandle Handle;
+				AbilitySetFixture->GrantToAbilitySystem(ASC, Handle);
+			}
+			const double PerActorTime = FPlatformTime::Seconds() - PerActorStartTime;
+
+			const double BatchStartTime = FPlatformTime::Seconds();
+			TArray<FGSCAbilitySetHandle> Handles;
+			AbilitySetFixture->GrantToAbilitySystems(ASCs, Handles);
+			const double BatchTime = FPlatformTime::Seconds() - BatchStartTime;
+
+			AddInfo(FString::Printf(TEXT("Granting to %d ASCs - Per actor: %.3f ms, Batch: %.3f ms"), NumActors, PerActorTime * 1000.0, BatchTime * 1000.0));
+
+			// Both paths should end up with the same state
+			for (int32 Index = 0; Index < NumActors; ++Index)
+			{
+				TestEqual(
+					FString::Printf(TEXT("ASC %d Health matches per actor grant"), Index),
+					ASCs[Index]->GetNumericAttributeBase(UGSCAttributeSet::GetHealthAttribute()),
+					PerActorASCs[Index]->GetNumericAttributeBase(UGSCAttributeSet::GetHealthAttribute())
+				);
+			}
+
+			for (AGSCModularCharacter* Actor : PerActorActors)
+			{
+				World->EditorDestroyActor(Actor, false);
+			}
+		});
+	});
+
+	AfterEach([this]()
+	{
+		AddInfo(TEXT("After Each ..."));
+
+		// Destroy the actors
+		for (AGSCModularCharacter* Actor : Actors)
+		{
+			if (Actor)
+			{
+				World->EditorDestroyActor(Actor, false);
+			}
+		}
+
+		Actors.Reset();
+		ASCs.Reset();
+
+		// Destroy World
+		FGASCompanionTestsUtils::TeardownWorld(World, InitialFrameCounter);
+	});
+}
@@ -0,0 +1,74 @@
+﻿// Copyright 2021-2022 Mickael Daniel. All Rights Reserved.
+
+#include "Components/GSCComboManagerComponent.h"
+#include "Misc/AutomationTest.h"
+#include "Serialization/BitReader.h"
+#include "Serialization/BitWriter.h"
+
+BEGIN_DEFINE_SPEC(FGSCComboReplicatedStateSpec, "GASCompanion.Runtime", EAutomationTestFlags::ProductFilter | EAutomationTestFlags::ApplicationContextMask)
+	static bool RoundTrip(FGSCComboReplicatedState& InState, FGSCComboReplicatedState& OutState, int64& OutNumBits);
+END_DEFINE_SPEC(FGSCComboReplicatedStateSpec)
+
+bool FGSCComboReplicatedStateSpec::RoundTrip(FGSCComboReplicatedState& InState, FGSCComboReplicatedState& OutState, int64& OutNumBits)
+{
+	bool bSuccess = false;
+
+	FBitWriter Writer(0, true);
+	InState.NetSerialize(Writer, nullptr, bSuccess);
+	OutNumBits = Writer.GetNumBits();
+
+	FBitReader Reader(Writer.GetData(), Writer.GetNumBits());
+	OutState.NetSerialize(Reader, nullptr, bSuccess);
+
+	return bSuccess && !Reader.IsError();
+}
+
+void FGSCComboReplicatedStateSpec::Define()
+{
+	Describe(TEXT("Combo Replicated State"), [this]()
+	{
+		It(TEXT("should round trip combo index and flags"), [this]()
+		{
+			FGSCComboReplicatedState State;
+			State.ComboIndex = 3;
+			State.bComboWindowOpened = true;
+			State.bRequestTriggerCombo = true;
+
+			FGSCComboReplicatedState Received;
+			int64 NumBits = 0;
+			TestTrue(TEXT("Serialized successfully"), RoundTrip(State, Received, NumBits));
+			TestTrue(TEXT("Received state matches"), State == Received);
+		});
+
+		It(TEXT("should round trip large combo index"), [this]()
+		{
+			FGSCComboReplicatedState State;
+			State.ComboIndex = 1000;
+			State.bNextComboAbilityActivated = true;
+
+			FGSCComboReplicatedState Received;
+			int64 NumBits = 0;
+			TestTrue(TEXT("Serialized successfully"), RoundTrip(State, Received, NumBits));
+			TestTrue(TEXT("Received state matches"), State == Received);
+		});
+
+		It(TEXT("should be smaller than the previous per property layout"), [this]()
+		{
+			FGSCComboReplicatedState State;
+			State.ComboIndex = 2;
+			State.bComboWindowOpened = true;
+			State.bShouldTriggerCombo = true;
+			State.bRequestTriggerCombo = true;
+			State.bNextComboAbilityActivated = true;
+
+			FGSCComboReplicatedState Received;
+			int64 NumBits = 0;
+			TestTrue(TEXT("Serialized successfully"), RoundTrip(State, Received, NumBits));
+
+			// int32 combo index plus four bools, property handles excluded
+			constexpr int64 PreviousNumBits = 32 + 4;
+			AddInfo(FString::Printf(TEXT("Combo state: %lld bits (previously %lld bits)"), NumBits, PreviousNumBits));
+			TestTrue(TEXT("Packed state is smaller"), NumBits < PreviousNumBits);
+		});
+	});
+}
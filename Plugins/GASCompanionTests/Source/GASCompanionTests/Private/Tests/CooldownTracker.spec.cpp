@@ -0,0 +1,103 @@
+﻿// Copyright 2021-2022 Mickael Daniel. All Rights Reserved.
+
+#include "GASCompanionTestsNativeTags.h"
+#include "Abilities/GSCAbilitySystemComponent.h"
+#include "Abilities/TestCooldownAbility.h"
+#include "Engine/World.h"
+#include "Misc/AutomationTest.h"
+#include "ModularGameplayActors/GSCModularCharacter.h"
+#include "Utils/GASCompanionTestsUtils.h"
+
+BEGIN_DEFINE_SPEC(FGSCCooldownTrackerSpec, "GASCompanion.Runtime", EAutomationTestFlags::ProductFilter | EAutomationTestFlags::ApplicationContextMask)
+	UWorld* World = nullptr;
+	uint64 InitialFrameCounter = 0;
+
+	AGSCModularCharacter* SourceActor = nullptr;
+	UGSCAbilitySystemComponent* SourceASC = nullptr;
+
+	/** Advances world time (and its timers) by the given duration */
+	void TickWorld(float InDuration, float InDeltaSeconds = 0.05f);
+END_DEFINE_SPEC(FGSCCooldownTrackerSpec)
+
+void FGSCCooldownTrackerSpec::TickWorld(const float InDuration, const float InDeltaSeconds)
+{
+	for (float Elapsed = 0.f; Elapsed < InDuration; Elapsed += InDeltaSeconds)
+	{
+		// Timer manager only ticks once per frame
+		++GFrameCounter;
+		World->Tick(LEVELTICK_All, InDeltaSeconds);
+	}
+}
+
+void FGSCCooldownTrackerSpec::Define()
+{
+	Describe(TEXT("Cooldown Tracker"), [this]()
+	{
+		BeforeEach([this]()
+		{
+			World = FGASCompanionTestsUtils::CreateWorld(InitialFrameCounter);
+
+			SourceActor = World->SpawnActor<AGSCModularCharacter>();
+			SourceASC = Cast<UGSCAbilitySystemComponent>(SourceActor->GetAbilitySystemComponent());
+			if (!SourceASC)
+			{
+				AddError(TEXT("Source actor ASC is not a UGSCAbilitySystemComponent"));
+				return;
+			}
+
+			SourceASC->GiveAbility(FGameplayAbilitySpec(UTestCooldownAbility_01::StaticClass()));
+			SourceASC->GiveAbility(FGameplayAbilitySpec(UTestCooldownAbility_02::StaticClass()));
+		});
+
+		It(TEXT("should end staggered cooldowns from its timer"), [this]()
+		{
+			if (!SourceASC)
+			{
+				return;
+			}
+
+			const FGameplayTag FirstCooldownTag = FGASCompanionTestsNativeTags::Get().CooldownTest_01;
+			const FGameplayTag SecondCooldownTag = FGASCompanionTestsNativeTags::Get().CooldownTest_02;
+
+			TArray<FGameplayTag> EndedCooldownTags;
+			const FDelegateHandle Handle = SourceASC->GetCooldownTracker().OnCooldownEnd.AddLambda([&EndedCooldownTags](UGameplayAbility* Ability, const FGameplayTag& CooldownTag, float Duration)
+			{
+				EndedCooldownTags.Add(CooldownTag);
+			});
+
+			TestTrue(TEXT("First ability activated"), SourceASC->TryActivateAbilityByClass(UTestCooldownAbility_01::StaticClass()));
+			TestTrue(TEXT("Second ability activated"), SourceASC->TryActivateAbilityByClass(UTestCooldownAbility_02::StaticClass()));
+
+			// Cooldowns are loose tags, removing them doesn't notify OnAnyGameplayEffectRemovedDelegate. Ends can only come from the timer.
+			FGameplayTagContainer CooldownTags;
+			CooldownTags.AddTag(FirstCooldownTag);
+			CooldownTags.AddTag(SecondCooldownTag);
+			SourceASC->RemoveLooseGameplayTags(CooldownTags);
+
+			TickWorld(0.2f);
+			TestEqual(TEXT("First cooldown ended"), EndedCooldownTags.Num(), 1);
+			TestTrue(TEXT("First cooldown ended first"), EndedCooldownTags.Num() > 0 && EndedCooldownTags[0] == FirstCooldownTag);
+
+			// Timer set again for the second cooldown from within the first timer callback
+			TickWorld(0.3f);
+			TestEqual(TEXT("Both cooldowns ended"), EndedCooldownTags.Num(), 2);
+			TestTrue(TEXT("Second cooldown ended last"), EndedCooldownTags.Num() > 1 && EndedCooldownTags[1] == SecondCooldownTag);
+
+			float TimeRemaining = 0.f;
+			float Duration = 0.f;
+			TestFalse(TEXT("No cooldown tracked anymore"), SourceASC->GetCooldownTracker().GetCooldownRemainingForClass(UTestCooldownAbility::StaticClass(), TimeRemaining, Duration));
+
+			SourceASC->GetCooldownTracker().OnCooldownEnd.Remove(Handle);
+		});
+
+		AfterEach([this]()
+		{
+			if (SourceActor)
+			{
+				World->EditorDestroyActor(SourceActor, false);
+			}
+
+			FGASCompanionTestsUtils::TeardownWorld(World, InitialFrameCounter);
+		});
+	});
+}
@@ -0,0 +1,141 @@
+﻿// Copyright 2021-2022 Mickael Daniel. All Rights Reserved.
+
+#include "Abilities/GSCAbilitySystemComponent.h"
+#include "Abilities/GSCInputLatencyTracker.h"
+#include "Engine/World.h"
+#include "Misc/AutomationTest.h"
+#include "ModularGameplayActors/GSCModularCharacter.h"
+#include "Utils/GASCompanionTestsUtils.h"
+
+BEGIN_DEFINE_SPEC(FGSCInputLatencySpec, "GASCompanion.Runtime", EAutomationTestFlags::ProductFilter | EAutomationTestFlags::ApplicationContextMask)
+	UWorld* World = nullptr;
+	uint64 InitialFrameCounter = 0;
+
+	AGSCModularCharacter* SourceActor = nullptr;
+	UAbilitySystemComponent* SourceASC = nullptr;
+
+	bool bWasEnabled = false;
+
+	static constexpr int32 TestInputID = 42;
+END_DEFINE_SPEC(FGSCInputLatencySpec)
+
+void FGSCInputLatencySpec::Define()
+{
+	BeforeEach([this]()
+	{
+		bWasEnabled = FGSCInputLatencyTracker::IsEnabled();
+		FGSCInputLatencyTracker::Get().Reset();
+	});
+
+	Describe(TEXT("Input Latency Histogram"), [this]()
+	{
+		It(TEXT("should bucket samples in powers of two"), [this]()
+		{
+			FGSCInputLatencyHistogram Histogram;
+			Histogram.AddSample(0.5);
+			Histogram.AddSample(3.0);
+			Histogram.AddSample(300.0);
+
+			TestEqual(TEXT("Count"), Histogram.Count, 3u);
+			TestEqual(TEXT("Below 1ms bucket"), Histogram.Buckets[0], 1u);
+			TestEqual(TEXT("Below 4ms bucket"), Histogram.Buckets[2], 1u);
+			TestEqual(TEXT("Above 256ms bucket"), Histogram.Buckets[FGSCInputLatencyHistogram::NumBuckets - 1], 1u);
+			TestEqual(TEXT("Min"), Histogram.MinMs, 0.5);
+			TestEqual(TEXT("Max"), Histogram.MaxMs, 300.0);
+			TestEqual(TEXT("Median"), Histogram.GetPercentileMs(0.5), 4.0);
+			TestEqual(TEXT("Last percentile clamped to max"), Histogram.GetPercentileMs(1.0), 300.0);
+		});
+	});
+
+	Describe(TEXT("Input Latency Tracker"), [this]()
+	{
+		BeforeEach([this]()
+		{
+			World = FGASCompanionTestsUtils::CreateWorld(InitialFrameCounter);
+
+			SourceActor = World->SpawnActor<AGSCModularCharacter>();
+			SourceASC = SourceActor->GetAbilitySystemComponent();
+			SourceASC->GiveAbility(FGameplayAbilitySpec(UGameplayAbility::StaticClass(), 1, TestInputID));
+		});
+
+		It(TEXT("should record nothing when disabled"), [this]()
+		{
+			FGSCInputLatencyTracker::SetEnabled(false);
+
+			FGSCInputLatencyTracker::Get().BeginInput(SourceASC, TestInputID);
+			SourceASC->AbilityLocalInputPressed(TestInputID);
+
+			const FName AbilityClassName = UGameplayAbility::StaticClass()->GetFName();
+			TestTrue(TEXT("No activation latency recorded"), FGSCInputLatencyTracker::Get().FindHistogram(AbilityClassName, EGSCInputLatencyStage::Activated) == nullptr);
+		});
+
+		It(TEXT("should record stages from ability input to activation"), [this]()
+		{
+			if (!SourceASC->IsA<UGSCAbilitySystemComponent>())
+			{
+				AddError(TEXT("Source actor ASC is not a UGSCAbilitySystemComponent"));
+				return;
+			}
+
+			FGSCInputLatencyTracker::SetEnabled(true);
+
+			FGSCInputLatencyTracker::Get().BeginInput(SourceASC, TestInputID);
+			SourceASC->AbilityLocalInputPressed(TestInputID);
+
+			const FGSCInputLatencyTracker& Tracker = FGSCInputLatencyTracker::Get();
+			const FName AbilityClassName = UGameplayAbility::StaticClass()->GetFName();
+
+			const FGSCInputLatencyHistogram* AbilityInput = Tracker.FindHistogram(AbilityClassName, EGSCInputLatencyStage::AbilityInput);
+			const FGSCInputLatencyHistogram* ActivationRequested = Tracker.FindHistogram(AbilityClassName, EGSCInputLatencyStage::ActivationRequested);
+			const FGSCInputLatencyHistogram* Activated = Tracker.FindHistogram(AbilityClassName, EGSCInputLatencyStage::Activated);
+			if (!AbilityInput || !ActivationRequested || !Activated)
+			{
+				AddError(TEXT("Missing input latency stages for the activated ability"));
+				return;
+			}
+
+			TestEqual(TEXT("One activation recorded"), Activated->Count, 1u);
+			TestTrue(TEXT("Activation comes after activation request"), Activated->MaxMs >= ActivationRequested->MaxMs);
+			TestTrue(TEXT("No combo gating for a non combo ability"), Tracker.FindHistogram(AbilityClassName, EGSCInputLatencyStage::ComboGating) == nullptr);
+			TestTrue(TEXT("No server confirmation on authority"), Tracker.FindHistogram(AbilityClassName, EGSCInputLatencyStage::ServerConfirmed) == nullptr);
+			TestTrue(TEXT("CSV output contains the ability class"), Tracker.ToCSV().Contains(AbilityClassName.ToString()));
+		});
+
+		It(TEXT("should ignore activations not coming from an ability input"), [this]()
+		{
+			FGSCInputLatencyTracker::SetEnabled(true);
+
+			SourceASC->TryActivateAbilityByClass(UGameplayAbility::StaticClass());
+
+			const FName AbilityClassName = UGameplayAbility::StaticClass()->GetFName();
+			TestTrue(TEXT("No activation latency recorded"), FGSCInputLatencyTracker::Get().FindHistogram(AbilityClassName, EGSCInputLatencyStage::Activated) == nullptr);
+		});
+
+		It(TEXT("should ignore activations of an ability not bound to the pending input"), [this]()
+		{
+			FGSCInputLatencyTracker::SetEnabled(true);
+
+			FGSCInputLatencyTracker::Get().BeginInput(SourceASC, TestInputID + 1);
+			SourceASC->TryActivateAbilityByClass(UGameplayAbility::StaticClass());
+
+			const FName AbilityClassName = UGameplayAbility::StaticClass()->GetFName();
+			TestTrue(TEXT("No activation latency recorded"), FGSCInputLatencyTracker::Get().FindHistogram(AbilityClassName, EGSCInputLatencyStage::Activated) == nullptr);
+		});
+
+		AfterEach([this]()
+		{
+			if (SourceActor)
+			{
+				World->EditorDestroyActor(SourceActor, false);
+			}
+
+			FGASCompanionTestsUtils::TeardownWorld(World, InitialFrameCounter);
+		});
+	});
+
+	AfterEach([this]()
+	{
+		FGSCInputLatencyTracker::Get().Reset();
+		FGSCInputLatencyTracker::SetEnabled(bWasEnabled);
+	});
+}
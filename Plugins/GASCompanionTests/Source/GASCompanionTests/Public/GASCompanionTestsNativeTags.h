@@ -23,6 +23,8 @@ struct GASCOMPANIONTESTS_API FGASCompanionTestsNativeTags : public FGameplayTagN
 	FGameplayTag StateTest_07;
 	FGameplayTag StateTest_08;
 	FGameplayTag StateTest_09;
+	FGameplayTag CooldownTest_01;
+	FGameplayTag CooldownTest_02;
 
 	FORCEINLINE static const FGASCompanionTestsNativeTags& Get() { return NativeTags; }
 
@@ -44,6 +46,8 @@ struct GASCOMPANIONTESTS_API FGASCompanionTestsNativeTags : public FGameplayTagN
 		StateTest_07 = Manager.AddNativeGameplayTag(TEXT("GASCompanionTests.State.Test_07"));
 		StateTest_08 = Manager.AddNativeGameplayTag(TEXT("GASCompanionTests.State.Test_08"));
 		StateTest_09 = Manager.AddNativeGameplayTag(TEXT("GASCompanionTests.State.Test_09"));
+		CooldownTest_01 = Manager.AddNativeGameplayTag(TEXT("GASCompanionTests.Cooldown.Test_01"));
+		CooldownTest_02 = Manager.AddNativeGameplayTag(TEXT("GASCompanionTests.Cooldown.Test_02"));
 	}
 
 private: